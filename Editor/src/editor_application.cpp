@@ -28,9 +28,9 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
-    bool EditorApplication::Initialize(const std::string& configPath)
+    bool EditorApplication::Initialize(const ProgramOptions& programOptions)
     {
-        if (!WindowApplication::Initialize(configPath))
+        if (!WindowApplication::Initialize(programOptions))
         {
             return false;
         }
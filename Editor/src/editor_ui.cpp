@@ -158,6 +158,7 @@ namespace Storyteller
 
         if (ImGui::BeginChild("StatusBar", ImGui::GetContentRegionAvail(), false, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoDocking))
         {
+            _compositor->ComposeStatusBar();
             ImGui::EndChild();
         }
     }
@@ -11,6 +11,8 @@
 #include <imgui_internal.h>
 #include <misc/cpp/imgui_stdlib.h>
 
+#include <charconv>
+
 namespace Storyteller
 {
     EditorUiCompositor::EditorUiCompositor(const Ptr<Window> window, const Ptr<I18N::Manager> i18nManager)
@@ -19,6 +21,7 @@ namespace Storyteller
         , _gameDocumentManager(CreatePtr<GameDocumentManager>(i18nManager))
         , _lookupDict(nullptr)
     {
+        _labels.fill(I18N::InvalidMessageId);
         FillDictionary();
         _i18nManager->AddLocaleChangedCallback(STRTLR_BIND(EditorUiCompositor::FillDictionary));
     }
@@ -26,6 +29,14 @@ namespace Storyteller
 
     void EditorUiCompositor::Compose()
     {
+        _gameDocumentManager->UpdateAsyncSave();
+
+        if (_state.autosaveInterval > 0 && ImGui::GetTime() - _state.lastAutosaveTime > _state.autosaveInterval)
+        {
+            _gameDocumentManager->Autosave();
+            _state.lastAutosaveTime = ImGui::GetTime();
+        }
+
         if (!Filesystem::PathExists(Filesystem::GetCurrentPath().append(ImGui::GetIO().IniFilename)))
         {
             ComposeDefaultPanelsLayout();
@@ -49,6 +60,32 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
+    void EditorUiCompositor::ComposeStatusBar()
+    {
+        ImGui::SetCursorPos(ImGui::GetStyle().FramePadding);
+
+        switch (_gameDocumentManager->GetSaveState())
+        {
+        case GameDocumentManager::SaveState::SavingState:
+            ImGui::TextUnformatted(GetLabel(SavingLabel).c_str());
+            ImGui::SameLine();
+            ImGui::ProgressBar(_gameDocumentManager->GetSaveProgress(), ImVec2(200.0f, 0.0f));
+            break;
+
+        case GameDocumentManager::SaveState::SucceededState:
+            ImGui::TextUnformatted(GetLabel(DocumentSavedLabel).c_str());
+            break;
+
+        case GameDocumentManager::SaveState::FailedState:
+            ImGui::TextUnformatted(GetLabel(DocumentSavingFailedLabel).c_str());
+            break;
+
+        default:
+            break;
+        }
+    }
+    //--------------------------------------------------------------------------
+
     bool EditorUiCompositor::OnKeyPressEvent(KeyPressEvent& event)
     {
         const auto keyCode = event.GetKeyCode();
@@ -109,6 +146,7 @@ namespace Storyteller
         settings->StartSaveGroup("EditorUiCompositor");
         settings->SaveBool("Log", _state.logPanel);
         settings->SaveBool("LogAutoscroll", _state.logAutoscroll);
+        settings->SaveInt("AutosaveInterval", _state.autosaveInterval);
         settings->SaveString("Language", _i18nManager->GetLocale());
         settings->StartSaveArray("RecentDocuments");
         for (const auto& recent : _recentList)
@@ -125,6 +163,7 @@ namespace Storyteller
         settings->StartLoadGroup("EditorUiCompositor");
         _state.logPanel = settings->GetBool("Log", true);
         _state.logAutoscroll = settings->GetBool("LogAutoscroll", false);
+        _state.autosaveInterval = settings->GetInt("AutosaveInterval", 30);
         _i18nManager->SetLocale(settings->GetString("Language", I18N::LocaleEnUTF8Keyword));
         const auto recentSize = settings->StartLoadArray("RecentDocuments");
         for (auto i = 0; i < recentSize; i++)
@@ -179,7 +218,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuFile()
     {
-        if (ImGui::BeginMenu(_lookupDict->Get("File").c_str()))
+        if (ImGui::BeginMenu(GetLabel(FileLabel).c_str()))
         {
             ComposeMenuItemNew();
             ComposeMenuItemOpen();
@@ -199,7 +238,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuView()
     {
-        if (ImGui::BeginMenu(_lookupDict->Get("View").c_str()))
+        if (ImGui::BeginMenu(GetLabel(ViewLabel).c_str()))
         {
             ComposeMenuItemLog();
             ComposeMenuItemFullscreen();
@@ -212,7 +251,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemNew()
     {
-        if (ImGui::MenuItem(_lookupDict->Get("New").c_str(), "Ctrl+N"))
+        if (ImGui::MenuItem(GetLabel(NewLabel).c_str(), "Ctrl+N"))
         {
             _popups.newDocument = true;
         }
@@ -221,7 +260,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemOpen()
     {
-        if (ImGui::MenuItem(_lookupDict->Get("Open").c_str(), "Ctrl+O"))
+        if (ImGui::MenuItem(GetLabel(OpenLabel).c_str(), "Ctrl+O"))
         {
             _popups.openDocument = true;
             _popups.openDocumentFile = "";
@@ -232,7 +271,7 @@ namespace Storyteller
     void EditorUiCompositor::ComposeMenuItemOpenRecent()
     {
         UiUtils::DisableGuard guard(_recentList.empty());
-        if (ImGui::BeginMenu(_lookupDict->Get("Open recent").c_str()))
+        if (ImGui::BeginMenu(GetLabel(OpenRecentLabel).c_str()))
         {
             for (const auto& recentFile : _recentList)
             {
@@ -248,7 +287,7 @@ namespace Storyteller
             if (!_recentList.empty())
             {
                 ImGui::Separator();
-                if (ImGui::MenuItem(_lookupDict->Get("Clear").c_str()))
+                if (ImGui::MenuItem(GetLabel(ClearLabel).c_str()))
                 {
                     _recentList.clear();
                 }
@@ -261,7 +300,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemSave()
     {
-        if (ImGui::MenuItem(_lookupDict->Get("Save").c_str(), "Ctrl+S"))
+        if (ImGui::MenuItem(GetLabel(SaveLabel).c_str(), "Ctrl+S"))
         {
             SaveDocument();
         }
@@ -270,7 +309,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemSaveAs()
     {
-        if (ImGui::MenuItem(_lookupDict->Get("Save as...").c_str(), "Ctrl+Shift+S"))
+        if (ImGui::MenuItem(GetLabel(SaveAsLabel).c_str(), "Ctrl+Shift+S"))
         {
             SaveAsDocument();
         }
@@ -279,7 +318,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemQuit()
     {
-        if (ImGui::MenuItem(_lookupDict->Get("Quit").c_str(), "Ctrl+Q"))
+        if (ImGui::MenuItem(GetLabel(QuitLabel).c_str(), "Ctrl+Q"))
         {
             _popups.quit = true;
         }
@@ -294,7 +333,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemLog()
     {
-        ImGui::MenuItem(_lookupDict->Get("Log").c_str(), "Ctrl+L", &_state.logPanel);
+        ImGui::MenuItem(GetLabel(LogLabel).c_str(), "Ctrl+L", &_state.logPanel);
     }
     //--------------------------------------------------------------------------
 
@@ -302,7 +341,7 @@ namespace Storyteller
     {
         const auto screenMode = _window->GetScreenMode();
         auto isFullscreen = screenMode == Window::WindowedFullscreenMode;
-        if (ImGui::MenuItem(_lookupDict->Get("Fullscreen").c_str(), "Alt+Enter", &isFullscreen))
+        if (ImGui::MenuItem(GetLabel(FullscreenLabel).c_str(), "Alt+Enter", &isFullscreen))
         {
             _window->SetScreenMode(isFullscreen ? Window::WindowedFullscreenMode : Window::WindowedMode);
         }        
@@ -311,7 +350,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeMenuItemLanguage()
     {
-        if (ImGui::BeginMenu(_lookupDict->Get("Language").c_str()))
+        if (ImGui::BeginMenu(GetLabel(LanguageLabel).c_str()))
         {
             if (ImGui::MenuItem(I18N::LocaleEnName))
             {
@@ -333,7 +372,7 @@ namespace Storyteller
         const auto document = _gameDocumentManager->GetDocument();
         const auto mainFlags = document->IsDirty() ? ImGuiWindowFlags_UnsavedDocument : ImGuiWindowFlags();
         const auto pathUnicode = Filesystem::ToU8String(document->GetPath());
-        auto windowTitle = pathUnicode.empty() ? _lookupDict->Get("Untitled document") : pathUnicode;
+        auto windowTitle = pathUnicode.empty() ? GetLabel(UntitledDocumentLabel) : pathUnicode;
         windowTitle.append("###GamePanel");
 
         if (ImGui::Begin(windowTitle.c_str(), nullptr, mainFlags))
@@ -351,12 +390,12 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeGameDocumentPanelGame()
     {
-        ImGui::SeparatorText(_lookupDict->Get("Game document").c_str());
+        ImGui::SeparatorText(GetLabel(GameDocumentLabel).c_str());
 
         const auto document = _gameDocumentManager->GetDocument();
 
-        const auto& nameTitle = _lookupDict->Get("Name");
-        const auto& translationsDomainTitle = _lookupDict->Get("Translation domain");
+        const auto& nameTitle = GetLabel(NameLabel);
+        const auto& translationsDomainTitle = GetLabel(TranslationDomainLabel);
         const auto inputWidth = ImGui::GetContentRegionAvail().x - ImGui::CalcTextSize(translationsDomainTitle.c_str()).x - ImGui::GetStyle().ItemSpacing.x;
 
         {
@@ -370,7 +409,7 @@ namespace Storyteller
                     if (gameName.empty())
                     {
                         _popups.warningMessage = true;
-                        _popups.warningMessageText = _lookupDict->Get("Game name cannot be empty!");
+                        _popups.warningMessageText = GetLabel(EmptyGameNameLabel);
                     }
                     else
                     {
@@ -379,7 +418,7 @@ namespace Storyteller
                 }
             }
 
-            auto gameNameTranslation = _i18nManager->Translation(document->GetDomainName(), gameName);
+            auto gameNameTranslation = _i18nManager->TranslationLazy(document->GetDomainName(), gameName);
             UiUtils::StyleColorGuard colorGuard({ {ImGuiCol_FrameBg, ImColor(0, 0, 0, 0)} });
             ImGui::InputText("###GameNameTranslation", &gameNameTranslation, ImGuiInputTextFlags_ReadOnly);
         }
@@ -395,7 +434,7 @@ namespace Storyteller
                     if (gameDomainName.empty())
                     {
                         _popups.warningMessage = true;
-                        _popups.warningMessageText = _lookupDict->Get("Game domain name cannot be empty!");
+                        _popups.warningMessageText = GetLabel(EmptyGameDomainNameLabel);
                     }
                     else
                     {
@@ -405,7 +444,7 @@ namespace Storyteller
             }
         }
 
-        if (ImGui::Button(_lookupDict->Get("Create translations file").c_str()))
+        if (ImGui::Button(GetLabel(CreateTranslationsFileLabel).c_str()))
         {
             const auto documentPath = document->GetPath();
             std::string filepath;
@@ -415,7 +454,7 @@ namespace Storyteller
             }
             else
             {
-                filepath = Dialogs::SaveFile(_lookupDict->Get("Save translations"), { "Text Files", "*.txt" });
+                filepath = Dialogs::SaveFile(GetLabel(SaveTranslationsLabel), { "Text Files", "*.txt" });
             }
 
             if (!filepath.empty())
@@ -428,7 +467,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposeGameDocumentPanelObjectsManagement()
     {
-        ImGui::SeparatorText(_lookupDict->Get("Objects management").c_str());
+        ImGui::SeparatorText(GetLabel(ObjectsManagementLabel).c_str());
 
         const auto proxy = _gameDocumentManager->GetProxy();
 
@@ -439,7 +478,7 @@ namespace Storyteller
             {
                 ImGui::OpenPopup("AddObjectPopup");
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Add object").c_str());
+            UiUtils::SetItemTooltip(GetLabel(AddObjectLabel).c_str());
 
             if (ImGui::BeginPopup("AddObjectPopup"))
             {
@@ -463,7 +502,7 @@ namespace Storyteller
             {
                 ImGui::OpenPopup("ObjectFilterPopup");
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Visibility filters").c_str());
+            UiUtils::SetItemTooltip(GetLabel(VisibilityFiltersLabel).c_str());
 
             if (ImGui::BeginPopup("ObjectFilterPopup"))
             {
@@ -482,11 +521,6 @@ namespace Storyteller
 
         if (ImGui::Checkbox(_i18nManager->TranslationOrSource(STRTLR_TR_DOMAIN_ENGINE, ObjectTypeToString(objectType)).c_str(), &filterState))
         {
-            if (filterState)
-            {
-                proxy->UpdateCache();
-            }
-
             proxy->DoFilter(objectType, filterState);
         }
     }
@@ -496,6 +530,20 @@ namespace Storyteller
     {
         const auto proxy = _gameDocumentManager->GetProxy();
 
+        UiUtils::GroupGuard groupGuard;
+
+        {
+            UiUtils::ItemWidthGuard guard(-FLT_MIN);
+            const auto searchHint = std::string(ICON_FK_SEARCH " ").append(GetLabel(SearchByNameOrTextLabel));
+            ImGui::InputTextWithHint("##ObjectSearch", searchHint.c_str(), &_state.objectSearch);
+
+            // a new or opened document comes with a fresh proxy, so the query is compared rather than tracked by edits
+            if (proxy->GetSearchQuery() != _state.objectSearch)
+            {
+                proxy->DoSearch(_state.objectSearch);
+            }
+        }
+
         const auto objectsTableFlags = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable
             | ImGuiTableFlags_ScrollY | ImGuiTableFlags_NoHostExtendX | ImGuiTableFlags_Sortable;
 
@@ -508,12 +556,12 @@ namespace Storyteller
         const auto objectsCount = proxy->GetObjects().size();
         const auto summaryText = I18N::Translator::Format(_i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "total {1} object", "total {1} objects", objectsCount), objectsCount);
         const auto tableOuterSize = ImVec2(0.0f, ImGui::GetContentRegionAvail().y - ImGui::CalcTextSize(summaryText.c_str()).y - ImGui::GetStyle().ItemSpacing.y);
-        if (ImGui::BeginTable(_lookupDict->Get("Objects").c_str(), 4, objectsTableFlags, tableOuterSize))
+        if (ImGui::BeginTable(GetLabel(ObjectsLabel).c_str(), 4, objectsTableFlags, tableOuterSize))
         {
-            ImGui::TableSetupColumn(_lookupDict->Get("Actions").c_str(), ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoSort, 65.0f);
-            ImGui::TableSetupColumn(_lookupDict->Get("Type").c_str(), ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort);
-            ImGui::TableSetupColumn(_lookupDict->Get("UUID").c_str(), ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort);
-            ImGui::TableSetupColumn(_lookupDict->Get("Name").c_str(), ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn(GetLabel(ActionsLabel).c_str(), ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoSort, 65.0f);
+            ImGui::TableSetupColumn(GetLabel(TypeLabel).c_str(), ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn(GetLabel(UuidLabel).c_str(), ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn(GetLabel(NameLabel).c_str(), ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_DefaultSort);
             ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableHeadersRow();
 
@@ -528,76 +576,99 @@ namespace Storyteller
                 }
             }
 
-            auto objects = proxy->GetObjects();
-            for (auto row = 0; row < objects.size(); row++)
+            // strings shared by all rows are looked up once per frame
+            const auto deleteObjectTooltip = GetLabel(DeleteObjectLabel);
+            const auto findObjectTooltip = GetLabel(FindObjectLabel);
+            const std::string typeNames[] = {
+                _i18nManager->TranslationOrSource(STRTLR_TR_DOMAIN_ENGINE, ObjectTypeToString(ObjectType::QuestObjectType)),
+                _i18nManager->TranslationOrSource(STRTLR_TR_DOMAIN_ENGINE, ObjectTypeToString(ObjectType::ActionObjectType))
+            };
+
+            // removal invalidates the proxy cache, so it is deferred until all visible rows are composed
+            auto removeUuid = UUID::InvalidUuid;
+
+            const auto& objects = proxy->GetObjects();
+            ImGuiListClipper clipper;
+            clipper.Begin(int(objects.size()));
+            while (clipper.Step())
             {
-                ImGui::TableNextRow();
+                for (auto row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
 
-                const auto object = objects[row];
-                const auto consistent = object->IsConsistent();
-                auto selected = proxy->IsSelected(object->GetUuid());
+                    const auto& object = objects[row];
+                    const auto uuid = object->GetUuid();
+                    const auto type = object->GetObjectType();
+                    const auto consistent = proxy->IsConsistent(uuid);
+                    auto selected = proxy->IsSelected(uuid);
 
-                {
-                    UiUtils::IDGuard guard(object->GetUuid());
-                    ImGui::TableNextColumn();
-                    if (ImGui::Button(ICON_FK_TRASH))
                     {
-                        if (object->GetObjectType() == ObjectType::QuestObjectType)
+                        UiUtils::IDGuard guard(uuid);
+                        ImGui::TableNextColumn();
+                        if (ImGui::Button(ICON_FK_TRASH))
+                        {
+                            removeUuid = uuid;
+                        }
+                        UiUtils::SetItemTooltip(deleteObjectTooltip);
+
+                        if (type == ObjectType::ActionObjectType)
                         {
-                            const auto actionObjects = _gameDocumentManager->GetProxy()->GetObjects<ActionObject>();
-                            for (const auto actionObject : actionObjects)
+                            const auto actionObject = static_cast<const ActionObject*>(object.get());
+                            const auto actionHasValidTarget = actionObject->GetTargetUuid() != UUID::InvalidUuid && proxy->GetObject(actionObject->GetTargetUuid());
+                            ImGui::SameLine();
+
                             {
-                                if (actionObject->GetTargetUuid() == object->GetUuid())
+                                UiUtils::DisableGuard disableGuard(!actionHasValidTarget);
+                                if (ImGui::Button(ICON_FK_SEARCH))
                                 {
-                                    actionObject->SetTargetUuid(UUID::InvalidUuid);
+                                    if (actionHasValidTarget)
+                                    {
+                                        proxy->Select(actionObject->GetTargetUuid());
+                                    }
                                 }
                             }
+                            UiUtils::SetItemTooltip(findObjectTooltip);
                         }
-
-                        proxy->RemoveObject(object->GetUuid());
-                        objects = proxy->GetObjects();
                     }
-                    UiUtils::SetItemTooltip(_lookupDict->Get("Delete object").c_str());
 
-                    if (object->GetObjectType() == ObjectType::ActionObjectType)
                     {
-                        const auto actionObject = dynamic_cast<ActionObject*>(object.get());
-                        const auto actionHasValidTarget = actionObject && actionObject->GetTargetUuid() != UUID::InvalidUuid && proxy->GetObject(actionObject->GetTargetUuid());
-                        ImGui::SameLine();
+                        UiUtils::StyleColorGuard guard({ {ImGuiCol_Text, consistent ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 0.5f, 0.5f, 1.0f)}});
 
+                        ImGui::TableNextColumn();
+                        ImGui::Selectable(typeNames[int(type)].c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+
+                        if (ImGui::IsItemClicked(0))
                         {
-                            UiUtils::DisableGuard disableGuard(!actionHasValidTarget);
-                            if (ImGui::Button(ICON_FK_SEARCH))
+                            proxy->Select(uuid);
+                        }
+
+                        if (!consistent && ImGui::IsItemHovered())
+                        {
+                            std::string diagnosticsText;
+                            for (const auto& diagnostic : proxy->GetDiagnostics(uuid))
                             {
-                                if (actionHasValidTarget)
-                                {
-                                    proxy->Select(actionObject->GetTargetUuid());
-                                }
+                                diagnosticsText.append(_i18nManager->TranslationOrSource(STRTLR_TR_DOMAIN_ENGINE, DiagnosticTypeToString(diagnostic.type))).append("\n");
                             }
+                            UiUtils::SetItemTooltip(diagnosticsText);
                         }
-                        UiUtils::SetItemTooltip(_lookupDict->Get("Find object").c_str());
-                    }
-                }
 
-                {
-                    UiUtils::StyleColorGuard guard({ {ImGuiCol_Text, consistent ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 0.5f, 0.5f, 1.0f)}});
+                        // formatted in place, visible rows never allocate for their UUID
+                        char uuidString[24];
+                        const auto uuidStringEnd = std::to_chars(std::begin(uuidString), std::end(uuidString), uint64_t(uuid)).ptr;
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(uuidString, uuidStringEnd);
 
-                    ImGui::TableNextColumn();
-                    ImGui::Selectable(_i18nManager->TranslationOrSource(STRTLR_TR_DOMAIN_ENGINE, ObjectTypeToString(object->GetObjectType())).c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
-
-                    if (ImGui::IsItemClicked(0))
-                    {
-                        proxy->Select(object->GetUuid());
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(object->GetName().c_str());
                     }
-
-                    ImGui::TableNextColumn();
-                    ImGui::TextUnformatted(std::to_string(object->GetUuid()).c_str());
-
-                    ImGui::TableNextColumn();
-                    ImGui::TextUnformatted(object->GetName().c_str());
                 }
             }
 
+            if (removeUuid != UUID::InvalidUuid)
+            {
+                proxy->RemoveObjects({ removeUuid });
+            }
+
             ImGui::EndTable();
         }
 
@@ -607,7 +678,7 @@ namespace Storyteller
 
     void EditorUiCompositor::ComposePropertiesPanel()
     {
-        auto title = _lookupDict->Get("Properties");
+        auto title = GetLabel(PropertiesLabel);
         if (ImGui::Begin(title.append("###Properties").c_str(), nullptr))
         {
             const auto selectedObject = _gameDocumentManager->GetProxy()->GetSelectedObject();
@@ -638,7 +709,7 @@ namespace Storyteller
     {
         STRTLR_ASSERT(selectedObject);
 
-        ImGui::SeparatorText(_lookupDict->Get("Name").c_str());
+        ImGui::SeparatorText(GetLabel(NameLabel).c_str());
 
         const auto uuidString = std::to_string(selectedObject->GetUuid());
 
@@ -650,14 +721,14 @@ namespace Storyteller
             if (objectName.empty())
             {
                 _popups.warningMessage = true;
-                _popups.warningMessageText = _lookupDict->Get("Object name cannot be empty!");
+                _popups.warningMessageText = GetLabel(EmptyObjectNameLabel);
                 return;
             }
 
             if (oldObjectName != objectName && !_gameDocumentManager->GetProxy()->SetObjectName(selectedObject->GetUuid(), objectName))
             {
                 _popups.warningMessage = true;
-                _popups.warningMessageText = _lookupDict->Get("Object name already exists!");
+                _popups.warningMessageText = GetLabel(ExistingObjectNameLabel);
             }
         }
     }
@@ -667,7 +738,7 @@ namespace Storyteller
     {
         STRTLR_ASSERT(selectedObject);
 
-        ImGui::SeparatorText(_lookupDict->Get("Source text").c_str());
+        ImGui::SeparatorText(GetLabel(SourceTextLabel).c_str());
 
         const auto uuidString = std::to_string(selectedObject->GetUuid());
         const auto textPanelHeight = ImGui::GetContentRegionAvail().y / 4.0f;
@@ -676,12 +747,12 @@ namespace Storyteller
 
         if (ImGui::InputTextMultiline(std::string("##ObjectText").append(uuidString).c_str(), &sourceText, ImVec2(-FLT_MIN, textPanelHeight), ImGuiInputTextFlags_EnterReturnsTrue) && selectedTextObject)
         {
-            selectedTextObject->SetText(sourceText);
+            _gameDocumentManager->GetProxy()->SetObjectText(selectedObject->GetUuid(), sourceText);
         }
 
-        ImGui::SeparatorText(_lookupDict->Get("Translation").c_str());
+        ImGui::SeparatorText(GetLabel(TranslationLabel).c_str());
 
-        auto sourceTextTranslation = selectedTextObject ? _i18nManager->Translation(_gameDocumentManager->GetDocument()->GetDomainName(), selectedTextObject->GetText()) : std::string();
+        auto sourceTextTranslation = selectedTextObject ? _i18nManager->TranslationLazy(_gameDocumentManager->GetDocument()->GetDomainName(), selectedTextObject->GetText()) : std::string();
         UiUtils::StyleColorGuard colorGuard({ {ImGuiCol_FrameBg, ImColor(0, 0, 0, 0)} });
         ImGui::InputTextMultiline(std::string("##Translation").append(uuidString).c_str(), &sourceTextTranslation, ImVec2(-FLT_MIN, textPanelHeight), ImGuiInputTextFlags_ReadOnly);
     }
@@ -697,12 +768,12 @@ namespace Storyteller
         const auto selectedUuid = selectedObject->GetUuid();
 
         auto selectedQuestObject = dynamic_cast<QuestObject*>(selectedObject.get());
-        const auto allActionObjects = proxy->GetObjects<ActionObject>();
+        const auto& allActionObjects = proxy->GetObjects<ActionObject>();
 
         const auto entryPointObject = proxy->GetEntryPoint();
         auto isEntryPoint = entryPointObject ? (entryPointObject->GetUuid() == selectedUuid) : false;
 
-        if (ImGui::Checkbox(_lookupDict->Get("Entry point").c_str(), &isEntryPoint))
+        if (ImGui::Checkbox(GetLabel(EntryPointLabel).c_str(), &isEntryPoint))
         {
             proxy->SetEntryPoint(selectedUuid);
         }
@@ -714,7 +785,7 @@ namespace Storyteller
 
         auto isFinal = selectedQuestObject->IsFinal();
         ImGui::SameLine();
-        if (ImGui::Checkbox(_lookupDict->Get("Final").c_str(), &isFinal))
+        if (ImGui::Checkbox(GetLabel(FinalLabel).c_str(), &isFinal))
         {
             selectedQuestObject->SetFinal(isFinal);
         }
@@ -726,12 +797,12 @@ namespace Storyteller
                 selectedQuestObject->AddAction(allActionObjects.at(_state.selectedActionIndex)->GetUuid());
             }
         }
-        UiUtils::SetItemTooltip(_lookupDict->Get("Add action to object").c_str());
+        UiUtils::SetItemTooltip(GetLabel(AddActionToObjectLabel).c_str());
 
         ImGui::SameLine();
 
         {
-            const auto title = _lookupDict->Get("Action name");
+            const auto title = GetLabel(ActionNameLabel);
             UiUtils::ItemWidthGuard guard(ImGui::GetContentRegionAvail().x - ImGui::CalcTextSize(title.c_str()).x - ImGui::GetStyle().ItemSpacing.x);
             UiUtils::DisableGuard disableGuard(allActionObjects.empty());
             if (ImGui::BeginCombo(title.c_str(), allActionObjects.empty() ? "" : allActionObjects[_state.selectedActionIndex]->GetName().c_str()))
@@ -760,7 +831,7 @@ namespace Storyteller
             _state.selectedChildActionIndex = 0;
         }
 
-        ImGui::SeparatorText(_lookupDict->Get("Actions").c_str());
+        ImGui::SeparatorText(GetLabel(ActionsLabel).c_str());
 
         const auto actionsTableFlags = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable 
             | ImGuiTableFlags_NoHostExtendX | ImGuiTableFlags_ScrollY;
@@ -784,7 +855,7 @@ namespace Storyteller
                     _state.selectedChildActionIndex--;
                 }
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Move action up").c_str());
+            UiUtils::SetItemTooltip(GetLabel(MoveActionUpLabel).c_str());
 
             {
                 UiUtils::DisableGuard disableGuard(questObjectActions.empty() || _state.selectedChildActionIndex >= (questObjectActions.size() - 1));
@@ -794,15 +865,15 @@ namespace Storyteller
                     _state.selectedChildActionIndex++;
                 }
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Move action down").c_str());
+            UiUtils::SetItemTooltip(GetLabel(MoveActionDownLabel).c_str());
         }
 
         ImGui::SameLine();
-        if (ImGui::BeginTable(_lookupDict->Get("Objects's actions").c_str(), 3, actionsTableFlags))
+        if (ImGui::BeginTable(GetLabel(ObjectActionsLabel).c_str(), 3, actionsTableFlags))
         {
-            ImGui::TableSetupColumn(_lookupDict->Get("Actions").c_str(), ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_WidthFixed, 65.0f);
-            ImGui::TableSetupColumn(_lookupDict->Get("Name").c_str(), ImGuiTableColumnFlags_WidthFixed);
-            ImGui::TableSetupColumn(_lookupDict->Get("Text").c_str(), ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn(GetLabel(ActionsLabel).c_str(), ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_WidthFixed, 65.0f);
+            ImGui::TableSetupColumn(GetLabel(NameLabel).c_str(), ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn(GetLabel(TextLabel).c_str(), ImGuiTableColumnFlags_WidthStretch);
             ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableHeadersRow();
 
@@ -832,7 +903,7 @@ namespace Storyteller
                         selectedQuestObject->RemoveAction(actionObject->GetUuid());
                         continue;
                     }
-                    UiUtils::SetItemTooltip(_lookupDict->Get("Remove action from object").c_str());
+                    UiUtils::SetItemTooltip(GetLabel(RemoveActionFromObjectLabel).c_str());
 
                     ImGui::SameLine();
                     if (ImGui::Button(ICON_FK_SEARCH))
@@ -840,10 +911,10 @@ namespace Storyteller
                         proxy->Select(actionObject->GetUuid());
                         break;
                     }
-                    UiUtils::SetItemTooltip(_lookupDict->Get("Find action object").c_str());
+                    UiUtils::SetItemTooltip(GetLabel(FindActionObjectLabel).c_str());
                 }
 
-                UiUtils::StyleColorGuard guard({ {ImGuiCol_Text, actionObject->IsConsistent() ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 0.5f, 0.5f, 1.0f)}});
+                UiUtils::StyleColorGuard guard({ {ImGuiCol_Text, proxy->IsConsistent(actionObject->GetUuid()) ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 0.5f, 0.5f, 1.0f)}});
 
                 ImGui::TableNextColumn();
                 ImGui::Selectable(object->GetName().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
@@ -853,7 +924,7 @@ namespace Storyteller
                 }
 
                 ImGui::TableNextColumn();
-                ImGui::TextUnformatted(_i18nManager->Translation(_gameDocumentManager->GetDocument()->GetDomainName(), actionObject->GetText()).c_str());
+                ImGui::TextUnformatted(_i18nManager->TranslationLazy(_gameDocumentManager->GetDocument()->GetDomainName(), actionObject->GetText()).c_str());
             }
 
             ImGui::EndTable();
@@ -869,7 +940,7 @@ namespace Storyteller
 
         const auto proxy = _gameDocumentManager->GetProxy();
         const auto selectedActionObject = dynamic_cast<ActionObject*>(selectedObject.get());
-        const auto allQuestObjects = proxy->GetObjects<QuestObject>();
+        const auto& allQuestObjects = proxy->GetObjects<QuestObject>();
 
         if (_state.selectedQuestIndex >= allQuestObjects.size())
         {
@@ -883,7 +954,7 @@ namespace Storyteller
                 selectedActionObject->SetTargetUuid(Storyteller::UUID::InvalidUuid);
             }
         }
-        UiUtils::SetItemTooltip(_lookupDict->Get("Clear target").c_str());
+        UiUtils::SetItemTooltip(GetLabel(ClearTargetLabel).c_str());
 
         ImGui::SameLine();
         {
@@ -893,11 +964,11 @@ namespace Storyteller
                 selectedActionObject->SetTargetUuid(allQuestObjects.at(_state.selectedQuestIndex)->GetUuid());
             }
         }
-        UiUtils::SetItemTooltip(_lookupDict->Get("Set target").c_str());
+        UiUtils::SetItemTooltip(GetLabel(SetTargetLabel).c_str());
 
         ImGui::SameLine();
         {
-            const auto title = _lookupDict->Get("Quest object name");
+            const auto title = GetLabel(QuestObjectNameLabel);
             UiUtils::ItemWidthGuard guard(ImGui::GetContentRegionAvail().x - ImGui::CalcTextSize(title.c_str()).x - ImGui::GetStyle().ItemSpacing.x);
             UiUtils::DisableGuard disableGuard(allQuestObjects.empty());
             if (ImGui::BeginCombo(title.c_str(), allQuestObjects.empty() ? "" : allQuestObjects[_state.selectedQuestIndex]->GetName().c_str()))
@@ -919,10 +990,10 @@ namespace Storyteller
             }
         }
 
-        ImGui::TextUnformatted(_lookupDict->Get("Current target name: ").c_str());
+        ImGui::TextUnformatted(GetLabel(CurrentTargetNameLabel).c_str());
         ImGui::SameLine();
         const auto targetObject = proxy->GetObject(selectedActionObject->GetTargetUuid());
-        ImGui::TextUnformatted(targetObject ? std::string("[").append(targetObject->GetName()).append("]").c_str() : _lookupDict->Get("Not set or does not exist").c_str());
+        ImGui::TextUnformatted(targetObject ? std::string("[").append(targetObject->GetName()).append("]").c_str() : GetLabel(MissingTargetLabel).c_str());
 
 
         ImGui::SameLine();
@@ -933,13 +1004,13 @@ namespace Storyteller
                 proxy->Select(targetObject->GetUuid());
             }
         }
-        UiUtils::SetItemTooltip(_lookupDict->Get("Find object").c_str());
+        UiUtils::SetItemTooltip(GetLabel(FindObjectLabel).c_str());
     }
     //--------------------------------------------------------------------------
 
     void EditorUiCompositor::ComposeLogPanel()
     {
-        auto title = _lookupDict->Get("Log");
+        auto title = GetLabel(LogLabel);
         ImGui::Begin(title.append("###Log").c_str(), nullptr);
 
         auto singleScrollToEnd = false;
@@ -951,7 +1022,7 @@ namespace Storyteller
             {
                 singleScrollToEnd = true;
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Scroll to end").c_str());
+            UiUtils::SetItemTooltip(GetLabel(ScrollToEndLabel).c_str());
 
             {
                 UiUtils::StyleColorGuard colorGuard({ {ImGuiCol_Border, _state.logAutoscroll ? ImVec4(1, 1, 1, 1) : ImGui::GetStyleColorVec4(ImGuiCol_Border)} });
@@ -960,7 +1031,7 @@ namespace Storyteller
                     _state.logAutoscroll = !_state.logAutoscroll;
                 }
             }
-            UiUtils::SetItemTooltip(_lookupDict->Get("Autoscroll to end").c_str());
+            UiUtils::SetItemTooltip(GetLabel(AutoscrollToEndLabel).c_str());
         }
 
         ImGui::SameLine();
@@ -1013,17 +1084,17 @@ namespace Storyteller
     {
         if (_gameDocumentManager->GetDocument()->IsDirty())
         {
-            const auto& title = _lookupDict->Get("New document");
+            const auto& title = GetLabel(NewDocumentLabel);
             ImGui::OpenPopup(title.c_str());
             const auto center = ImGui::GetMainViewport()->GetCenter();
             ImGui::SetNextWindowPos(center, ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
 
             if (ImGui::BeginPopupModal(title.c_str(), nullptr, ImGuiWindowFlags_AlwaysAutoResize))
             {
-                ImGui::TextUnformatted(_lookupDict->Get("You have unsaved changes, create new document anyway?").c_str());
+                ImGui::TextUnformatted(GetLabel(UnsavedNewDocumentLabel).c_str());
                 ImGui::Separator();
 
-                if (ImGui::Button(_lookupDict->Get("Yes").c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
+                if (ImGui::Button(GetLabel(YesLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
                 {
                     _gameDocumentManager->NewDocument();
                     _state.questObjectFilter = true;
@@ -1034,7 +1105,7 @@ namespace Storyteller
                 ImGui::SetItemDefaultFocus();
 
                 ImGui::SameLine();
-                if (ImGui::Button(_lookupDict->Get("No").c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
+                if (ImGui::Button(GetLabel(NoLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
                 {
                     _popups.newDocument = false;
                     ImGui::CloseCurrentPopup();
@@ -1057,7 +1128,7 @@ namespace Storyteller
     {
         if (_gameDocumentManager->GetDocument()->IsDirty())
         {
-            const auto& title = _lookupDict->Get("Quit");
+            const auto& title = GetLabel(QuitLabel);
 
             ImGui::OpenPopup(title.c_str());
             const auto center = ImGui::GetMainViewport()->GetCenter();
@@ -1065,11 +1136,12 @@ namespace Storyteller
 
             if (ImGui::BeginPopupModal(title.c_str(), nullptr, ImGuiWindowFlags_AlwaysAutoResize))
             {
-                ImGui::TextUnformatted(_lookupDict->Get("You have unsaved changes, quit anyway?").c_str());
+                ImGui::TextUnformatted(GetLabel(UnsavedQuitLabel).c_str());
                 ImGui::Separator();
 
-                if (ImGui::Button(_lookupDict->Get("Yes").c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
+                if (ImGui::Button(GetLabel(YesLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
                 {
+                    _gameDocumentManager->DiscardJournal();
                     _window->SetShouldClose(true);
                     _popups.quit = false;
                     ImGui::CloseCurrentPopup();
@@ -1077,7 +1149,7 @@ namespace Storyteller
                 ImGui::SetItemDefaultFocus();
 
                 ImGui::SameLine();
-                if (ImGui::Button(_lookupDict->Get("No").c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
+                if (ImGui::Button(GetLabel(NoLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
                 {
                     _window->SetShouldClose(false);
                     _popups.quit = false;
@@ -1097,7 +1169,7 @@ namespace Storyteller
 
     void EditorUiCompositor::PopupWarningMessage()
     {
-        const auto& title = _lookupDict->Get("Warning");
+        const auto& title = GetLabel(WarningLabel);
         ImGui::OpenPopup(title.c_str());
         const auto center = ImGui::GetMainViewport()->GetCenter();
         ImGui::SetNextWindowPos(center, ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
@@ -1107,7 +1179,7 @@ namespace Storyteller
             ImGui::TextUnformatted(_popups.warningMessageText.c_str());
             ImGui::Separator();
 
-            if (ImGui::Button(_lookupDict->Get("Ok").c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
+            if (ImGui::Button(GetLabel(OkLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
             {
                 _popups.warningMessage = false;
                 ImGui::CloseCurrentPopup();
@@ -1123,7 +1195,7 @@ namespace Storyteller
     {
         if (_gameDocumentManager->GetDocument()->IsDirty())
         {
-            const auto& title = _lookupDict->Get("Open");
+            const auto& title = GetLabel(OpenLabel);
 
             ImGui::OpenPopup(title.c_str());
             const auto center = ImGui::GetMainViewport()->GetCenter();
@@ -1131,14 +1203,14 @@ namespace Storyteller
 
             if (ImGui::BeginPopupModal(title.c_str(), nullptr, ImGuiWindowFlags_AlwaysAutoResize))
             {
-                ImGui::TextUnformatted(_lookupDict->Get("You have unsaved changes, open other document anyway?").c_str());
+                ImGui::TextUnformatted(GetLabel(UnsavedOpenDocumentLabel).c_str());
                 ImGui::Separator();
 
-                if (ImGui::Button(_lookupDict->Get("Yes").c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
+                if (ImGui::Button(GetLabel(YesLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x / 2, 0)))
                 {
                     if (_popups.openDocumentFile.empty())
                     {
-                        const auto filepath = Dialogs::OpenFile(_lookupDict->Get("Open document"), {"JSON Files", "*.json"});
+                        const auto filepath = Dialogs::OpenFile(GetLabel(OpenDocumentLabel), { "Game Documents", "*.json *.strtlr", "JSON Files", "*.json", "Binary Files", "*.strtlr" });
                         if (!filepath.empty())
                         {
                             OpenDocument(filepath);
@@ -1155,7 +1227,7 @@ namespace Storyteller
                 ImGui::SetItemDefaultFocus();
 
                 ImGui::SameLine();
-                if (ImGui::Button(_lookupDict->Get("No").c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
+                if (ImGui::Button(GetLabel(NoLabel).c_str(), ImVec2(ImGui::GetContentRegionAvail().x, 0)))
                 {
                     _popups.openDocument = false;
                     ImGui::CloseCurrentPopup();
@@ -1168,7 +1240,7 @@ namespace Storyteller
         {
             if (_popups.openDocumentFile.empty())
             {
-                const auto filepath = Dialogs::OpenFile(_lookupDict->Get("Open document"), { "JSON Files", "*.json" });
+                const auto filepath = Dialogs::OpenFile(GetLabel(OpenDocumentLabel), { "Game Documents", "*.json *.strtlr", "JSON Files", "*.json", "Binary Files", "*.strtlr" });
                 if (!filepath.empty())
                 {
                     OpenDocument(filepath);
@@ -1188,7 +1260,7 @@ namespace Storyteller
     {
         if (!_gameDocumentManager->GetDocument()->GetPath().empty())
         {
-            _gameDocumentManager->Save();
+            _gameDocumentManager->SaveAsync();
         }
         else
         {
@@ -1199,10 +1271,10 @@ namespace Storyteller
 
     void EditorUiCompositor::SaveAsDocument()
     {
-        const auto filepath = Dialogs::SaveFile(_lookupDict->Get("Save document"), { "JSON Files", "*.json" });
+        const auto filepath = Dialogs::SaveFile(GetLabel(SaveDocumentLabel), { "JSON Files", "*.json", "Binary Files", "*.strtlr" });
         if (!filepath.empty())
         {
-            _gameDocumentManager->Save(filepath);
+            _gameDocumentManager->SaveAsync(filepath);
         }
     }
     //--------------------------------------------------------------------------
@@ -1247,68 +1319,78 @@ namespace Storyteller
         _lookupDict = _i18nManager->GetLookupDictionary(STRTLR_TR_DOMAIN_EDITOR);
         STRTLR_ASSERT(_lookupDict);
 
-        _lookupDict->Add("Open", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Open"));
-        _lookupDict->Add("Quit", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Quit"));
-        _lookupDict->Add("Log", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Log"));
-        _lookupDict->Add("Name", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Name"));
-        _lookupDict->Add("Translation domain", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Translation domain"));
-        _lookupDict->Add("Actions", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Actions"));
-        _lookupDict->Add("Find object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Find object"));
-        _lookupDict->Add("New document", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "New document"));
-        _lookupDict->Add("Open document", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Open document"));
-        _lookupDict->Add("Yes", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Yes"));
-        _lookupDict->Add("No", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "No"));
-        _lookupDict->Add("Warning", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Warning"));
-        _lookupDict->Add("File", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "File"));
-        _lookupDict->Add("View", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "View"));
-        _lookupDict->Add("New", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "New"));
-        _lookupDict->Add("Open recent", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Open recent"));
-        _lookupDict->Add("Clear", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Clear"));
-        _lookupDict->Add("Save", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Save"));
-        _lookupDict->Add("Save as...", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Save as..."));
-        _lookupDict->Add("Fullscreen", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Fullscreen"));
-        _lookupDict->Add("Untitled document", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Untitled document"));
-        _lookupDict->Add("Game document", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Game document"));
-        _lookupDict->Add("Game name cannot be empty!", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Game name cannot be empty!"));
-        _lookupDict->Add("Game domain name cannot be empty!", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Game domain name cannot be empty!"));
-        _lookupDict->Add("Create translations file", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Create translations file"));
-        _lookupDict->Add("Save translations", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Save translations"));
-        _lookupDict->Add("Objects management", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Objects management"));
-        _lookupDict->Add("Add object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Add object"));
-        _lookupDict->Add("Visibility filters", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Visibility filters"));
-        _lookupDict->Add("Objects", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Objects"));
-        _lookupDict->Add("Type", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Type"));
-        _lookupDict->Add("UUID", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "UUID"));
-        _lookupDict->Add("Delete object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Delete object"));
-        _lookupDict->Add("Properties", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Properties"));
-        _lookupDict->Add("Object name cannot be empty!", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Object name cannot be empty!"));
-        _lookupDict->Add("Object name already exists!", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Object name already exists!"));
-        _lookupDict->Add("Source text", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Source text"));
-        _lookupDict->Add("Translation", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Translation"));
-        _lookupDict->Add("Entry point", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Entry point"));
-        _lookupDict->Add("Final", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Final"));
-        _lookupDict->Add("Add action to object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Add action to object"));
-        _lookupDict->Add("Action name", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Action name"));
-        _lookupDict->Add("Move action up", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Move action up"));
-        _lookupDict->Add("Move action down", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Move action down"));
-        _lookupDict->Add("Objects's actions", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Objects's actions"));
-        _lookupDict->Add("Text", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Text"));
-        _lookupDict->Add("Remove action from object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Remove action from object"));
-        _lookupDict->Add("Find action object", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Find action object"));
-        _lookupDict->Add("Clear target", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Clear target"));
-        _lookupDict->Add("Set target", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Set target"));
-        _lookupDict->Add("Quest object name", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Quest object name"));
-        _lookupDict->Add("Current target name: ", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Current target name: "));
-        _lookupDict->Add("Not set or does not exist", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Not set or does not exist"));
-        _lookupDict->Add("Scroll to end", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Scroll to end"));
-        _lookupDict->Add("Autoscroll to end", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Autoscroll to end"));
-        _lookupDict->Add("You have unsaved changes, create new document anyway?", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, create new document anyway?"));
-        _lookupDict->Add("You have unsaved changes, quit anyway?", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, quit anyway?"));
-        _lookupDict->Add("Ok", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Ok"));
-        _lookupDict->Add("You have unsaved changes, open other document anyway?", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, open other document anyway?"));
-        _lookupDict->Add("Save document", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Save document"));
+        _labels[OpenLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Open");
+        _labels[QuitLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Quit");
+        _labels[LogLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Log");
+        _labels[NameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Name");
+        _labels[TranslationDomainLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Translation domain");
+        _labels[ActionsLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Actions");
+        _labels[FindObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Find object");
+        _labels[NewDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "New document");
+        _labels[OpenDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Open document");
+        _labels[YesLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Yes");
+        _labels[NoLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "No");
+        _labels[WarningLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Warning");
+        _labels[FileLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "File");
+        _labels[ViewLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "View");
+        _labels[NewLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "New");
+        _labels[OpenRecentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Open recent");
+        _labels[ClearLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Clear");
+        _labels[SaveLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Save");
+        _labels[SaveAsLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Save as...");
+        _labels[SavingLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Saving...");
+        _labels[DocumentSavedLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Document saved");
+        _labels[DocumentSavingFailedLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Document saving failed");
+        _labels[FullscreenLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Fullscreen");
+        _labels[UntitledDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Untitled document");
+        _labels[GameDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Game document");
+        _labels[EmptyGameNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Game name cannot be empty!");
+        _labels[EmptyGameDomainNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Game domain name cannot be empty!");
+        _labels[CreateTranslationsFileLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Create translations file");
+        _labels[SaveTranslationsLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Save translations");
+        _labels[ObjectsManagementLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Objects management");
+        _labels[AddObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Add object");
+        _labels[VisibilityFiltersLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Visibility filters");
+        _labels[SearchByNameOrTextLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Search by name or text");
+        _labels[ObjectsLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Objects");
+        _labels[TypeLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Type");
+        _labels[UuidLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "UUID");
+        _labels[DeleteObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Delete object");
+        _labels[PropertiesLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Properties");
+        _labels[EmptyObjectNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Object name cannot be empty!");
+        _labels[ExistingObjectNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Object name already exists!");
+        _labels[SourceTextLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Source text");
+        _labels[TranslationLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Translation");
+        _labels[EntryPointLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Entry point");
+        _labels[FinalLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Final");
+        _labels[AddActionToObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Add action to object");
+        _labels[ActionNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Action name");
+        _labels[MoveActionUpLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Move action up");
+        _labels[MoveActionDownLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Move action down");
+        _labels[ObjectActionsLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Objects's actions");
+        _labels[TextLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Text");
+        _labels[RemoveActionFromObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Remove action from object");
+        _labels[FindActionObjectLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Find action object");
+        _labels[ClearTargetLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Clear target");
+        _labels[SetTargetLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Set target");
+        _labels[QuestObjectNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Quest object name");
+        _labels[CurrentTargetNameLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Current target name: ");
+        _labels[MissingTargetLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Not set or does not exist");
+        _labels[ScrollToEndLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Scroll to end");
+        _labels[AutoscrollToEndLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Autoscroll to end");
+        _labels[UnsavedNewDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, create new document anyway?");
+        _labels[UnsavedQuitLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, quit anyway?");
+        _labels[OkLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Ok");
+        _labels[UnsavedOpenDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "You have unsaved changes, open other document anyway?");
+        _labels[SaveDocumentLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Save document");
         _lookupDict->Add("The selected file is missing or damaged", "Popup message", _i18nManager->TranslateCtx(STRTLR_TR_DOMAIN_EDITOR, "The selected file is missing or damaged", "Popup message"));
-        _lookupDict->Add("Language", _i18nManager->Translate(STRTLR_TR_DOMAIN_EDITOR, "Language"));
+        _labels[LanguageLabel] = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_EDITOR, "Language");
+    }
+    //--------------------------------------------------------------------------
+
+    const std::string& EditorUiCompositor::GetLabel(Label label) const
+    {
+        return _lookupDict->Get(_labels[label]);
     }
     //--------------------------------------------------------------------------
 }
\ No newline at end of file
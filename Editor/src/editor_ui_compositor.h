@@ -9,6 +9,7 @@
 #include "Storyteller/window_event.h"
 
 #include <list>
+#include <array>
 
 namespace Storyteller
 {
@@ -18,6 +19,7 @@ namespace Storyteller
         EditorUiCompositor(const Ptr<Window> window, const Ptr<I18N::Manager> i18nManager);
 
         void Compose();
+        void ComposeStatusBar();
 
         bool OnKeyPressEvent(KeyPressEvent& event);
         bool OnWindowCloseEvent(WindowCloseEvent& event);
@@ -31,11 +33,85 @@ namespace Storyteller
             bool demoWindow = false;
             bool questObjectFilter = true;
             bool actionObjectFilter = true;
+            std::string objectSearch = "";
             int selectedChildActionIndex = 0;
             int selectedActionIndex = 0;
             int selectedQuestIndex = 0;
             bool logPanel = true;
             bool logAutoscroll = false;
+            int autosaveInterval = 30;
+            double lastAutosaveTime = 0.0;
+        };
+
+        // editor strings drawn every frame, looked up by the message id registered for each
+        enum Label
+        {
+            OpenLabel,
+            QuitLabel,
+            LogLabel,
+            NameLabel,
+            TranslationDomainLabel,
+            ActionsLabel,
+            FindObjectLabel,
+            NewDocumentLabel,
+            OpenDocumentLabel,
+            YesLabel,
+            NoLabel,
+            WarningLabel,
+            FileLabel,
+            ViewLabel,
+            NewLabel,
+            OpenRecentLabel,
+            ClearLabel,
+            SaveLabel,
+            SaveAsLabel,
+            SavingLabel,
+            DocumentSavedLabel,
+            DocumentSavingFailedLabel,
+            FullscreenLabel,
+            UntitledDocumentLabel,
+            GameDocumentLabel,
+            EmptyGameNameLabel,
+            EmptyGameDomainNameLabel,
+            CreateTranslationsFileLabel,
+            SaveTranslationsLabel,
+            ObjectsManagementLabel,
+            AddObjectLabel,
+            VisibilityFiltersLabel,
+            SearchByNameOrTextLabel,
+            ObjectsLabel,
+            TypeLabel,
+            UuidLabel,
+            DeleteObjectLabel,
+            PropertiesLabel,
+            EmptyObjectNameLabel,
+            ExistingObjectNameLabel,
+            SourceTextLabel,
+            TranslationLabel,
+            EntryPointLabel,
+            FinalLabel,
+            AddActionToObjectLabel,
+            ActionNameLabel,
+            MoveActionUpLabel,
+            MoveActionDownLabel,
+            ObjectActionsLabel,
+            TextLabel,
+            RemoveActionFromObjectLabel,
+            FindActionObjectLabel,
+            ClearTargetLabel,
+            SetTargetLabel,
+            QuestObjectNameLabel,
+            CurrentTargetNameLabel,
+            MissingTargetLabel,
+            ScrollToEndLabel,
+            AutoscrollToEndLabel,
+            UnsavedNewDocumentLabel,
+            UnsavedQuitLabel,
+            OkLabel,
+            UnsavedOpenDocumentLabel,
+            SaveDocumentLabel,
+            LanguageLabel,
+            LabelsCount
         };
 
         struct UiPopupsState
@@ -96,6 +172,7 @@ namespace Storyteller
         void SwitchFullscreen();
 
         void FillDictionary();
+        const std::string& GetLabel(Label label) const;
 
     private:
         const Ptr<Window> _window;
@@ -105,6 +182,7 @@ namespace Storyteller
         UiPopupsState _popups;
         std::list<std::string> _recentList;
         Ptr<I18N::LookupDictionary> _lookupDict;
+        std::array<I18N::MessageId, LabelsCount> _labels;
     };
     //--------------------------------------------------------------------------
 }
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Storyteller/game_document.h"
+#include "Storyteller/log.h"
+#include "Storyteller/platform.h"
+
+#if defined STRTLR_PLATFORM_WINDOWS
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Storyteller
+{
+    namespace Benchmark
+    {
+        inline void InitializeLog()
+        {
+            LogConfig logConfig;
+            logConfig.enabled = false;
+            logConfig.outputFile = false;
+            logConfig.outputStringBuffer = false;
+            Log::Initialize(logConfig);
+        }
+        //--------------------------------------------------------------------------
+
+        // largest benchmark size from the first argument, the default otherwise
+        inline std::size_t GetMaxCount(int argc, char** argv, std::size_t defaultCount)
+        {
+            return argc > 1 ? std::size_t(std::strtoull(argv[1], nullptr, 10)) : defaultCount;
+        }
+        //--------------------------------------------------------------------------
+
+        template<typename Function>
+        double Measure(Function&& function)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            function();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        }
+        //--------------------------------------------------------------------------
+
+        inline void Report(const std::string& name, std::size_t count, double milliseconds)
+        {
+            std::printf("%-48s %10zu %12.3f ms %12.1f ns/op\n", name.c_str(), count, milliseconds, count ? milliseconds * 1e6 / double(count) : 0.0);
+        }
+        //--------------------------------------------------------------------------
+
+        // largest resident set of the process so far, in bytes
+        inline std::size_t GetPeakMemoryUsage()
+        {
+#if defined STRTLR_PLATFORM_WINDOWS
+            PROCESS_MEMORY_COUNTERS counters = {};
+            return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? std::size_t(counters.PeakWorkingSetSize) : 0;
+#else
+            rusage usage = {};
+            getrusage(RUSAGE_SELF, &usage);
+    #if defined STRTLR_PLATFORM_MACOSX
+            return std::size_t(usage.ru_maxrss);
+    #else
+            return std::size_t(usage.ru_maxrss) * 1024;
+    #endif
+#endif
+        }
+        //--------------------------------------------------------------------------
+
+        // quests with a few actions each, actions target random quests and the last quests are final
+        inline Ptr<GameDocument> CreateDocument(std::size_t questsCount, std::size_t actionsPerQuest = 3, unsigned int seed = 1)
+        {
+            auto document = CreatePtr<GameDocument>();
+            document->SetGameName("Benchmark");
+            document->SetDomainName("Benchmark");
+
+            std::mt19937_64 random(seed);
+            const auto questUuid = [](std::size_t index) { return UUID(uint64_t(index + 1)); };
+            const auto actionUuid = [questsCount](std::size_t index) { return UUID(uint64_t(questsCount + index + 1)); };
+
+            for (std::size_t i = 0; i < questsCount; i++)
+            {
+                document->AddObject(ObjectType::QuestObjectType, questUuid(i));
+            }
+
+            for (std::size_t i = 0; i < questsCount; i++)
+            {
+                const auto quest = std::static_pointer_cast<QuestObject>(document->GetObject(questUuid(i)));
+                quest->SetText("Quest text " + std::to_string(random()) + " of the benchmark story");
+                quest->SetFinal(i + 1 == questsCount);
+
+                for (std::size_t a = 0; a < actionsPerQuest && !quest->IsFinal(); a++)
+                {
+                    const auto uuid = actionUuid(i * actionsPerQuest + a);
+                    document->AddObject(ObjectType::ActionObjectType, uuid);
+
+                    const auto action = std::static_pointer_cast<ActionObject>(document->GetObject(uuid));
+                    action->SetText("Action " + std::to_string(random() % 1000));
+                    action->SetTargetUuid(questUuid(random() % questsCount));
+                    quest->AddAction(uuid);
+                }
+            }
+
+            document->SetEntryPoint(questUuid(0));
+            document->ResetChanges();
+
+            return document;
+        }
+        //--------------------------------------------------------------------------
+    }
+}
\ No newline at end of file
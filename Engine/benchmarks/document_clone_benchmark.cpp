@@ -0,0 +1,43 @@
+#include "benchmark_utils.h"
+
+// Time of the document copy taken on the calling thread before a background save and of
+// indexing the copy on its first lookup
+// usage: StorytellerEngine_document_clone_benchmark [max objects count]
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+
+    for (std::size_t questsCount = 250; questsCount * 4 <= maxCount; questsCount *= 10)
+    {
+        const auto document = Benchmark::CreateDocument(questsCount);
+        const auto objectsCount = document->GetObjects().size();
+
+        Ptr<GameDocument> clone;
+        const auto cloneTime = Benchmark::Measure([&]() { clone = document->Clone(); });
+
+        if (clone->GetObjects().size() != objectsCount)
+        {
+            std::printf("clone of %zu objects has %zu objects\n", objectsCount, clone->GetObjects().size());
+            return 1;
+        }
+
+        // the first lookup by name indexes the copy, a copy that is only saved never does it
+        const auto name = document->GetObjects().back()->GetName();
+        Ptr<BasicObject> found;
+        const auto indexTime = Benchmark::Measure([&]() { found = clone->GetObject(name); });
+
+        if (!found || found->GetUuid() != document->GetObjects().back()->GetUuid())
+        {
+            std::printf("clone of %zu objects cannot find '%s'\n", objectsCount, name.c_str());
+            return 1;
+        }
+
+        Benchmark::Report("clone", objectsCount, cloneTime);
+        Benchmark::Report("clone, first lookup by name", objectsCount, indexTime);
+    }
+
+    return 0;
+}
\ No newline at end of file
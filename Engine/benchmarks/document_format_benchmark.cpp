@@ -0,0 +1,46 @@
+#include "benchmark_utils.h"
+#include "Storyteller/game_document_serializer.h"
+
+#include <filesystem>
+
+// Save and load times and file sizes of the JSON and binary document formats
+// usage: StorytellerEngine_document_format_benchmark [max objects count]
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+    const auto directory = std::filesystem::temp_directory_path() / "storyteller_document_format_benchmark";
+    std::filesystem::create_directories(directory);
+
+    for (std::size_t questsCount = 250; questsCount * 4 <= maxCount; questsCount *= 10)
+    {
+        const auto document = Benchmark::CreateDocument(questsCount);
+        const auto objectsCount = document->GetObjects().size();
+
+        for (const auto extension : { ".json", ".strtlr" })
+        {
+            const auto path = std::filesystem::path(directory / "document").concat(extension);
+            auto saved = false;
+            auto loaded = false;
+
+            const auto saveTime = Benchmark::Measure([&]() { saved = GameDocumentSerializer(document).Save(path); });
+            const auto loadedDocument = CreatePtr<GameDocument>();
+            const auto loadTime = Benchmark::Measure([&]() { loaded = GameDocumentSerializer(loadedDocument).Load(path); });
+
+            if (!saved || !loaded || loadedDocument->GetObjects().size() != objectsCount)
+            {
+                std::printf("%s round trip of %zu objects failed\n", extension, objectsCount);
+                return 1;
+            }
+
+            Benchmark::Report(std::string("save ") + extension, objectsCount, saveTime);
+            Benchmark::Report(std::string("load ") + extension, objectsCount, loadTime);
+            std::printf("%-48s %10zu %12ju bytes\n", (std::string("size ") + extension).c_str(), objectsCount, std::uintmax_t(std::filesystem::file_size(path)));
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "benchmark_utils.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// UUID index of the game document: adding objects as loading does, lookups of present and missing
+// objects and single removals
+// usage: StorytellerEngine_document_index_benchmark [max objects count]
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+
+    for (std::size_t count = 1000; count <= maxCount; count *= 10)
+    {
+        std::mt19937_64 random(count);
+        std::vector<UUID> uuids;
+        uuids.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            uuids.emplace_back(random() | 1);
+        }
+
+        const auto document = CreatePtr<GameDocument>();
+        std::size_t added = 0;
+        const auto addTime = Benchmark::Measure([&]() {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                added += document->AddObject(i % 4 ? ObjectType::ActionObjectType : ObjectType::QuestObjectType, uuids[i]);
+            }
+        });
+
+        std::shuffle(uuids.begin(), uuids.end(), random);
+        std::size_t found = 0;
+        const auto lookupTime = Benchmark::Measure([&]() {
+            for (const auto& uuid : uuids)
+            {
+                found += document->GetObject(uuid) != nullptr;
+            }
+        });
+
+        // even UUIDs are never used above
+        std::size_t missed = 0;
+        const auto missTime = Benchmark::Measure([&]() {
+            for (const auto& uuid : uuids)
+            {
+                missed += document->GetObject(UUID(uint64_t(uuid) - 1)) == nullptr;
+            }
+        });
+
+        const auto removeCount = std::min<std::size_t>(count, 1000);
+        std::size_t removed = 0;
+        const auto removeTime = Benchmark::Measure([&]() {
+            for (std::size_t i = 0; i < removeCount; i++)
+            {
+                removed += document->RemoveObject(uuids[i]);
+            }
+        });
+
+        if (added != count || found != count || missed != count || removed != removeCount || document->GetObjects().size() != count - removeCount)
+        {
+            std::printf("index of %zu objects: %zu added, %zu found, %zu missed, %zu removed\n", count, added, found, missed, removed);
+            return 1;
+        }
+
+        Benchmark::Report("add " + std::to_string(count), count, addTime);
+        Benchmark::Report("lookup " + std::to_string(count), count, lookupTime);
+        Benchmark::Report("lookup missing " + std::to_string(count), count, missTime);
+        Benchmark::Report("remove from " + std::to_string(count), removeCount, removeTime);
+    }
+
+    return 0;
+}
\ No newline at end of file
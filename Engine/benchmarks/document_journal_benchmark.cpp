@@ -0,0 +1,157 @@
+#include "benchmark_utils.h"
+#include "Storyteller/game_document_journal.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    using namespace Storyteller;
+
+    // same objects in the same order with the same contents
+    bool AreDocumentsEqual(const GameDocument& document, const GameDocument& expected)
+    {
+        const auto& objects = document.GetObjects();
+        const auto& expectedObjects = expected.GetObjects();
+        if (objects.size() != expectedObjects.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < objects.size(); i++)
+        {
+            const auto& object = *objects[i];
+            const auto& expectedObject = *expectedObjects[i];
+            if (object.GetUuid() != expectedObject.GetUuid() || object.GetObjectType() != expectedObject.GetObjectType() || object.GetName() != expectedObject.GetName()
+                || static_cast<const TextObject&>(object).GetText() != static_cast<const TextObject&>(expectedObject).GetText())
+            {
+                return false;
+            }
+
+            if (object.GetObjectType() == ObjectType::QuestObjectType)
+            {
+                const auto& questObject = static_cast<const QuestObject&>(object);
+                const auto& expectedQuestObject = static_cast<const QuestObject&>(expectedObject);
+                if (questObject.GetActions() != expectedQuestObject.GetActions() || questObject.IsFinal() != expectedQuestObject.IsFinal())
+                {
+                    return false;
+                }
+            }
+            else if (static_cast<const ActionObject&>(object).GetTargetUuid() != static_cast<const ActionObject&>(expectedObject).GetTargetUuid())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    // renames and retargets every step-th object starting from the first one
+    void EditDocument(GameDocument& document, std::size_t first, std::size_t step, const std::string& suffix)
+    {
+        const auto& objects = document.GetObjects();
+        for (auto i = first; i < objects.size(); i += step)
+        {
+            objects[i]->SetName(objects[i]->GetName() + suffix);
+            if (objects[i]->GetObjectType() == ObjectType::ActionObjectType)
+            {
+                static_cast<ActionObject&>(*objects[i]).SetTargetUuid(objects[(i * 7) % objects.size()]->GetUuid());
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    // what a crash in the middle of a record write leaves behind
+    void TearRecord(const std::filesystem::path& path)
+    {
+        std::ofstream outputStream(path, std::ios::out | std::ios::app | std::ios::binary);
+        outputStream << "{\"UUID\":12,\"Name\":\"torn";
+    }
+    //--------------------------------------------------------------------------
+
+    bool CheckRecovery(const std::string& name, const GameDocument& base, const GameDocument& expected, const std::filesystem::path& documentPath)
+    {
+        const auto recovered = base.Clone();
+        GameDocumentJournal(documentPath).Replay(*recovered);
+        if (!AreDocumentsEqual(*recovered, expected))
+        {
+            std::printf("%s: replayed document differs from the edited one\n", name.c_str());
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+}
+
+// Journal replay time and recovery of journals with records torn by a crash, the replayed
+// document must equal the edited one including the objects order
+// usage: StorytellerEngine_document_journal_benchmark [max objects count]
+int main(int argc, char** argv)
+{
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+    const auto documentPath = std::filesystem::temp_directory_path() / "storyteller_document_journal_benchmark.json";
+    const GameDocumentJournal journal(documentPath);
+
+    for (std::size_t questsCount = 250; questsCount * 4 <= maxCount; questsCount *= 10)
+    {
+        journal.Discard();
+
+        const auto base = Benchmark::CreateDocument(questsCount);
+        const auto edited = base->Clone();
+        const auto objectsCount = edited->GetObjects().size();
+
+        EditDocument(*edited, 0, 2, " edited");
+        const auto recordsCount = edited->GetChangedObjects().size();
+        journal.Append(*edited);
+
+        const auto replayed = base->Clone();
+        const auto replayTime = Benchmark::Measure([&]() { journal.Replay(*replayed); });
+        if (!AreDocumentsEqual(*replayed, *edited))
+        {
+            std::printf("replay of %zu records differs from the edited document\n", recordsCount);
+            return 1;
+        }
+
+        Benchmark::Report("replay", recordsCount, replayTime);
+
+        // a torn last record, then the recovered document is edited and journaled again
+        TearRecord(documentPath.string() + ".journal");
+        const auto recovered = base->Clone();
+        journal.Replay(*recovered);
+        EditDocument(*recovered, 1, 3, " recovered");
+        EditDocument(*edited, 1, 3, " recovered");
+        journal.Append(*recovered);
+        if (!CheckRecovery("torn journal", *base, *edited, documentPath))
+        {
+            return 1;
+        }
+
+        // a torn record in the middle of a rotated journal, left by a crash during a background save
+        TearRecord(documentPath.string() + ".journal");
+        journal.Rotate();
+        EditDocument(*edited, 2, 5, " rotated");
+        const auto rotated = base->Clone();
+        journal.Replay(*rotated);
+        EditDocument(*rotated, 2, 5, " rotated");
+        journal.Append(*rotated);
+        journal.Rotate();
+        if (!CheckRecovery("torn rotated journal", *base, *edited, documentPath))
+        {
+            return 1;
+        }
+
+        journal.RestoreRotated();
+        if (!CheckRecovery("restored journal", *base, *edited, documentPath))
+        {
+            return 1;
+        }
+
+        std::printf("%-48s %10zu objects recovered\n", "torn journals", objectsCount);
+    }
+
+    journal.Discard();
+    return 0;
+}
\ No newline at end of file
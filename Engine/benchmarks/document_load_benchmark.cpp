@@ -0,0 +1,121 @@
+#include "benchmark_utils.h"
+#include "Storyteller/game_document_serializer.h"
+#include "Storyteller/json_reader.h"
+#include "Storyteller/internal/game_document_json_keys.h"
+
+#include <filesystem>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    using namespace Storyteller;
+
+    // the document object model loader the streaming one replaced, the whole file is parsed before any object is made
+    bool LoadWithDom(const Ptr<GameDocument>& document, const std::filesystem::path& path)
+    {
+        JsonReader reader(path);
+        if (!reader.Start())
+        {
+            return false;
+        }
+
+        document->SetGameName(reader.GetString(JSON_KEY_GAME_NAME, "Untitled"));
+        document->SetDomainName(reader.GetString(JSON_KEY_GAME_DOMAIN_NAME, "Untitled"));
+        document->SetEntryPoint(UUID(reader.GetUInt64(JSON_KEY_ENTRY_POINT_UUID, UUID::InvalidUuid)));
+
+        const auto objectsCount = reader.StartArray(JSON_KEY_OBJECTS);
+        for (auto i = 0; i < objectsCount; i++)
+        {
+            reader.StartArrayObject(i);
+
+            const auto uuid = UUID(reader.GetUInt64(JSON_KEY_UUID));
+            switch (StringToObjectType(reader.GetString(JSON_KEY_OBJECT_TYPE)))
+            {
+            case ObjectType::QuestObjectType:
+            {
+                const auto questObject = CreatePtr<QuestObject>(uuid);
+                questObject->SetText(reader.GetString(JSON_KEY_TEXT));
+                questObject->SetName(reader.GetString(JSON_KEY_NAME));
+
+                const auto actionsCount = reader.StartArray(JSON_KEY_ACTIONS);
+                for (auto a = 0; a < actionsCount; a++)
+                {
+                    questObject->AddAction(UUID(reader.GetUInt64(a)));
+                }
+                reader.EndArray();
+
+                questObject->SetFinal(reader.GetBool(JSON_KEY_FINAL));
+                document->AddObject(questObject);
+                break;
+            }
+
+            case ObjectType::ActionObjectType:
+            {
+                const auto actionObject = CreatePtr<ActionObject>(uuid);
+                actionObject->SetTargetUuid(UUID(reader.GetUInt64(JSON_KEY_TARGET)));
+                actionObject->SetText(reader.GetString(JSON_KEY_TEXT));
+                actionObject->SetName(reader.GetString(JSON_KEY_NAME));
+                document->AddObject(actionObject);
+                break;
+            }
+
+            default:
+                return false;
+            }
+
+            reader.EndArrayObject();
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+}
+
+// Load time and peak memory of the streaming JSON loader against the document object model one;
+// peak memory is per process, so every loader runs in a process of its own
+// usage: StorytellerEngine_document_load_benchmark [quests count]
+//        StorytellerEngine_document_load_benchmark generate <path> <quests count>
+//        StorytellerEngine_document_load_benchmark sax|dom <path>
+int main(int argc, char** argv)
+{
+    Benchmark::InitializeLog();
+
+    if (argc == 4 && std::strcmp(argv[1], "generate") == 0)
+    {
+        const auto document = Benchmark::CreateDocument(std::size_t(std::strtoull(argv[3], nullptr, 10)));
+        return GameDocumentSerializer(document).Save(argv[2]) ? 0 : 1;
+    }
+
+    if (argc == 3 && (std::strcmp(argv[1], "sax") == 0 || std::strcmp(argv[1], "dom") == 0))
+    {
+        const auto dom = std::strcmp(argv[1], "dom") == 0;
+        const auto document = CreatePtr<GameDocument>();
+        auto loaded = false;
+        const auto loadTime = Benchmark::Measure([&]() { loaded = dom ? LoadWithDom(document, argv[2]) : GameDocumentSerializer(document).Load(argv[2]); });
+        if (!loaded || document->GetObjects().empty())
+        {
+            std::printf("%s loader failed to load '%s'\n", argv[1], argv[2]);
+            return 1;
+        }
+
+        const auto name = std::string("load ") + argv[1];
+        Benchmark::Report(name, document->GetObjects().size(), loadTime);
+        std::printf("%-48s %10zu %12.1f MiB peak\n", name.c_str(), document->GetObjects().size(), double(Benchmark::GetPeakMemoryUsage()) / (1024.0 * 1024.0));
+        return 0;
+    }
+
+    const auto questsCount = Benchmark::GetMaxCount(argc, argv, 250000);
+    const auto path = std::filesystem::temp_directory_path() / "storyteller_document_load_benchmark.json";
+    const auto command = [&](const std::string& arguments) {
+        return std::system(("\"" + std::string(argv[0]) + "\" " + arguments).c_str()) == 0;
+    };
+
+    const auto pathArgument = "\"" + path.string() + "\"";
+    const auto ok = command("generate " + pathArgument + " " + std::to_string(questsCount))
+        && command("sax " + pathArgument)
+        && command("dom " + pathArgument);
+
+    std::filesystem::remove(path);
+    return ok ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "benchmark_utils.h"
+#include "Storyteller/i18n_lookup_dictionary.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    using namespace Storyteller;
+
+    typedef std::unordered_map<I18N::ContextedSource, I18N::TranslationStr, I18N::ContextedSourceHash, I18N::ContextedSourceEqual> ContextedTranslations;
+
+    // user interface strings: a few words each, contexts are shared by many messages
+    std::vector<I18N::ContextedSource> CreateMessages(std::size_t count)
+    {
+        static const char* words[] = { "Open", "Save", "document", "quest", "action", "file", "Remove", "selected", "object", "name",
+            "Add", "new", "text", "target", "entry", "point", "Cannot", "find", "the", "Search" };
+        static const char* contexts[] = { "", "menu", "toolbar", "dialog", "button", "tooltip", "status", "error" };
+
+        std::mt19937_64 random(count);
+        std::unordered_set<I18N::ContextedSource, I18N::ContextedSourceHash, I18N::ContextedSourceEqual> unique;
+        std::vector<I18N::ContextedSource> messages;
+        messages.reserve(count);
+        while (messages.size() < count)
+        {
+            I18N::ContextedSource message;
+            const auto wordsCount = 1 + random() % 5;
+            for (std::size_t i = 0; i < wordsCount; i++)
+            {
+                message.source += (i ? " " : "") + std::string(words[random() % std::size(words)]);
+            }
+
+            message.source += " " + std::to_string(messages.size());
+            message.context = contexts[random() % std::size(contexts)];
+            if (unique.insert(message).second)
+            {
+                messages.push_back(std::move(message));
+            }
+        }
+
+        return messages;
+    }
+    //--------------------------------------------------------------------------
+
+    void ReportBuckets(const std::string& name, const ContextedTranslations& translations)
+    {
+        std::size_t emptyBuckets = 0;
+        std::size_t maxBucketSize = 0;
+        for (std::size_t i = 0; i < translations.bucket_count(); i++)
+        {
+            const auto bucketSize = translations.bucket_size(i);
+            emptyBuckets += bucketSize == 0;
+            maxBucketSize = std::max(maxBucketSize, bucketSize);
+        }
+
+        std::printf("%-48s %10zu %8zu buckets %8zu empty %4zu max %6.3f load\n", name.c_str(), translations.size(),
+            translations.bucket_count(), emptyBuckets, maxBucketSize, double(translations.load_factor()));
+    }
+    //--------------------------------------------------------------------------
+}
+
+// Contexted source hash collisions, insert and lookup throughput of the lookup dictionary and
+// bucket distribution of contexted translation maps
+// usage: StorytellerEngine_i18n_maps_benchmark [max messages count]
+int main(int argc, char** argv)
+{
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+
+    // every ordered pair of 300 strings, swapped pairs and pairs of equal strings included, must hash apart
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i < 300; i++)
+    {
+        strings.push_back("message " + std::to_string(i));
+    }
+
+    const I18N::ContextedSourceHash hash;
+    std::unordered_set<std::size_t> hashes;
+    for (const auto& source : strings)
+    {
+        for (const auto& context : strings)
+        {
+            if (!hashes.insert(hash(I18N::ContextedSourceView{ source, context })).second)
+            {
+                std::printf("hash of ('%s', '%s') collides\n", source.c_str(), context.c_str());
+                return 1;
+            }
+        }
+    }
+
+    std::printf("%-48s %10zu pairs without collisions\n", "contexted source hash", hashes.size());
+
+    for (std::size_t count = 1000; count <= maxCount; count *= 10)
+    {
+        const auto messages = CreateMessages(count);
+
+        I18N::LookupDictionary dictionary("Benchmark", "en_EN.UTF-8");
+        const auto insertTime = Benchmark::Measure([&]() {
+            for (const auto& message : messages)
+            {
+                dictionary.Add(message.source, message.context, message.source);
+            }
+        });
+
+        std::size_t found = 0;
+        const auto lookupTime = Benchmark::Measure([&]() {
+            for (const auto& message : messages)
+            {
+                found += dictionary.Get(message.source, message.context).size() == message.source.size();
+            }
+        });
+
+        // the same sources under a context none of them has
+        std::size_t missed = 0;
+        const auto missTime = Benchmark::Measure([&]() {
+            for (const auto& message : messages)
+            {
+                missed += dictionary.Get(message.source, "missing").empty();
+            }
+        });
+
+        if (found != count || missed != count)
+        {
+            std::printf("lookup of %zu messages found %zu and missed %zu\n", count, found, missed);
+            return 1;
+        }
+
+        Benchmark::Report("insert contexted", count, insertTime);
+        Benchmark::Report("lookup contexted", count, lookupTime);
+        Benchmark::Report("lookup contexted, missing", count, missTime);
+
+        ContextedTranslations translations;
+        for (const auto& message : messages)
+        {
+            translations.emplace(message, message.source);
+        }
+
+        ReportBuckets("buckets contexted", translations);
+    }
+
+    return 0;
+}
\ No newline at end of file
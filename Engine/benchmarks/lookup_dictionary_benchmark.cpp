@@ -0,0 +1,74 @@
+#include "benchmark_utils.h"
+#include "Storyteller/i18n_lookup_dictionary.h"
+
+#include <vector>
+
+// Per frame cost of the lookup dictionary: every frame translates the strings of a typical editor
+// screen by source and by registered message id, some of them without translation
+// usage: StorytellerEngine_lookup_dictionary_benchmark [frames count]
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    Benchmark::InitializeLog();
+    const auto framesCount = Benchmark::GetMaxCount(argc, argv, 100000);
+    const std::size_t stringsPerFrame = 64;
+
+    std::vector<std::string> sources;
+    for (std::size_t i = 0; i < stringsPerFrame; i++)
+    {
+        sources.push_back("Editor window label number " + std::to_string(i));
+    }
+
+    I18N::LookupDictionary dictionary("Benchmark", "ru_RU.UTF-8");
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        // every fourth string has no translation, like labels missing from a catalog
+        if (i % 4 != 0)
+        {
+            dictionary.Add(sources[i], "Translated " + sources[i]);
+        }
+    }
+
+    std::vector<I18N::MessageId> ids;
+    for (const auto& source : sources)
+    {
+        ids.push_back(dictionary.Register(source));
+    }
+
+    const auto lookupsCount = framesCount * stringsPerFrame;
+    std::size_t bySourceSize = 0;
+    const auto bySourceTime = Benchmark::Measure([&]() {
+        for (std::size_t frame = 0; frame < framesCount; frame++)
+        {
+            for (const auto& source : sources)
+            {
+                bySourceSize += dictionary.Get(std::string_view(source)).size();
+            }
+        }
+    });
+
+    std::size_t byIdSize = 0;
+    const auto byIdTime = Benchmark::Measure([&]() {
+        for (std::size_t frame = 0; frame < framesCount; frame++)
+        {
+            for (const auto id : ids)
+            {
+                byIdSize += dictionary.Get(id).size();
+            }
+        }
+    });
+
+    if (bySourceSize != byIdSize)
+    {
+        std::printf("lookups by source and by id returned different translations\n");
+        return 1;
+    }
+
+    Benchmark::Report("lookup by source", lookupsCount, bySourceTime);
+    Benchmark::Report("lookup by message id", lookupsCount, byIdTime);
+    std::printf("%-48s %10zu %12.3f us %12.3f us\n", "frame, by source / by message id", stringsPerFrame,
+        bySourceTime * 1e3 / double(framesCount), byIdTime * 1e3 / double(framesCount));
+
+    return 0;
+}
\ No newline at end of file
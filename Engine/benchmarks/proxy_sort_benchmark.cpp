@@ -0,0 +1,73 @@
+#include "benchmark_utils.h"
+#include "Storyteller/game_document_sort_filter_proxy_view.h"
+
+#include <algorithm>
+#include <random>
+
+// Proxy view sort per column against std::sort with the view's sorter, the orders must be equal
+// usage: StorytellerEngine_proxy_sort_benchmark [max objects count]
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+    using Sorter = GameDocumentSortFilterProxyView::Sorter;
+
+    Benchmark::InitializeLog();
+    const auto maxCount = Benchmark::GetMaxCount(argc, argv, 1000000);
+
+    const struct
+    {
+        const char* name;
+        Sorter::SortValue sortValue;
+        bool localeAware;
+    } columns[] = {
+        { "type", Sorter::Type, false },
+        { "uuid", Sorter::Uuid, false },
+        { "name", Sorter::Name, false },
+        { "name, locale aware", Sorter::Name, true },
+    };
+
+    for (std::size_t questsCount = 250; questsCount * 4 <= maxCount; questsCount *= 10)
+    {
+        const auto document = Benchmark::CreateDocument(questsCount);
+
+        // names share long prefixes and some end right at a multiple of 8 bytes, so the sort has to look
+        // past the first bytes of every key in a run
+        std::mt19937_64 random(questsCount);
+        for (std::size_t i = 0; i < document->GetObjects().size(); i++)
+        {
+            const auto uuid = document->GetObjects()[i]->GetUuid();
+            const auto name = "Chapter " + std::to_string(random() % 10) + ", quest";
+            if (random() % 2 != 0 || !document->SetObjectName(uuid, name))
+            {
+                document->SetObjectName(uuid, name + " " + std::to_string(i));
+            }
+        }
+
+        const auto objectsCount = document->GetObjects().size();
+        GameDocumentSortFilterProxyView proxy(document);
+
+        for (const auto& column : columns)
+        {
+            for (const auto ascending : { true, false })
+            {
+                const auto name = std::string("sort by ") + column.name + (ascending ? " ascending" : " descending");
+
+                const auto proxyTime = Benchmark::Measure([&]() { proxy.DoSort(ascending, column.sortValue, column.localeAware); });
+
+                auto expected = document->GetObjects();
+                const auto sortTime = Benchmark::Measure([&]() { std::sort(expected.begin(), expected.end(), Sorter(ascending, column.sortValue, column.localeAware)); });
+
+                if (proxy.GetObjects() != expected)
+                {
+                    std::printf("%s of %zu objects differs from std::sort\n", name.c_str(), objectsCount);
+                    return 1;
+                }
+
+                Benchmark::Report(name, objectsCount, proxyTime);
+                Benchmark::Report(name + ", std::sort", objectsCount, sortTime);
+            }
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
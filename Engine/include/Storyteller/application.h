@@ -1,6 +1,7 @@
 #pragma once
 
 #include "i18n_manager.h"
+#include "program_options.h"
 #include "settings.h"
 #include "pointers.h"
 #include "event.h"
@@ -19,7 +20,7 @@ namespace Storyteller
 
         virtual std::string GetApplicationName() const = 0;
 
-        virtual bool Initialize(const std::string& configPath);
+        virtual bool Initialize(const ProgramOptions& programOptions);
         virtual void Run() = 0;
 
     protected:
@@ -3,7 +3,9 @@
 #include "uuid.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <unordered_set>
 #include <functional>
 
 namespace Storyteller
@@ -19,11 +21,39 @@ namespace Storyteller
     ObjectType StringToObjectType(const std::string& string);
     //--------------------------------------------------------------------------
 
+    enum class ObjectChangeType
+    {
+        NameChangeType,
+        TextChangeType,
+        ActionAddChangeType,
+        ActionRemoveChangeType,
+        ActionMoveChangeType,
+        FinalChangeType,
+        TargetChangeType
+    };
+    //--------------------------------------------------------------------------
+
+    class BasicObject;
+
+    struct ObjectChange
+    {
+        ObjectChangeType type;
+        BasicObject* object;
+        // previous name or text, valid only during the callback
+        std::string_view previousString;
+        // added/removed/moved action or previous target
+        UUID relatedUuid;
+    };
+    //--------------------------------------------------------------------------
+
 
     class BasicObject
     {
     public:
-        explicit BasicObject(const UUID& uuid = UUID(), const std::function<void()>& changeCallback = nullptr);
+        typedef std::function<void(const ObjectChange&)> ChangeCallback;
+
+    public:
+        explicit BasicObject(const UUID& uuid = UUID(), const ChangeCallback& changeCallback = nullptr);
         virtual ~BasicObject() = default;
 
         UUID GetUuid() const;
@@ -31,15 +61,18 @@ namespace Storyteller
         const std::string& GetName() const;
         void SetName(const std::string& name);
 
-        void SetChangeCallback(const std::function<void()>& changeCallback);
+        void SetChangeCallback(const ChangeCallback& changeCallback);
 
         virtual ObjectType GetObjectType() const = 0;
         virtual bool IsConsistent() const = 0;
 
+    protected:
+        void NotifyChange(ObjectChangeType type, std::string_view previousString = {}, const UUID& relatedUuid = UUID::InvalidUuid);
+
     protected:
         const UUID _uuid;
         std::string _name;
-        std::function<void()> _changeCallback;
+        ChangeCallback _changeCallback;
     };
     //--------------------------------------------------------------------------
 
@@ -47,7 +80,7 @@ namespace Storyteller
     class TextObject : public BasicObject
     {
     public:
-        explicit TextObject(const UUID& uuid = UUID(), const std::function<void()>& changeCallback = nullptr);
+        explicit TextObject(const UUID& uuid = UUID(), const ChangeCallback& changeCallback = nullptr);
 
         const std::string& GetText() const;
         void SetText(const std::string& text);
@@ -63,7 +96,7 @@ namespace Storyteller
     class QuestObject : public TextObject
     {
     public:
-        explicit QuestObject(const UUID& uuid = UUID(), const std::function<void()>& changeCallback = nullptr);
+        explicit QuestObject(const UUID& uuid = UUID(), const ChangeCallback& changeCallback = nullptr);
 
         static ObjectType GetStaticObjectType();
         virtual ObjectType GetObjectType() const override;
@@ -72,6 +105,7 @@ namespace Storyteller
         const std::vector<UUID>& GetActions() const;
         bool AddAction(const UUID& actionUuid);
         bool RemoveAction(const UUID& actionUuid);
+        std::size_t RemoveActions(const std::unordered_set<UUID>& actionUuids);
         bool MoveActionUp(const UUID& actionUuid);
         bool MoveActionDown(const UUID& actionUuid);
         bool ContainsAction(const UUID& actionUuid) const;
@@ -90,7 +124,7 @@ namespace Storyteller
     class ActionObject : public TextObject
     {
     public:
-        explicit ActionObject(const UUID& uuid = UUID(), const std::function<void()>& changeCallback = nullptr);
+        explicit ActionObject(const UUID& uuid = UUID(), const ChangeCallback& changeCallback = nullptr);
 
         static ObjectType GetStaticObjectType();
         virtual ObjectType GetObjectType() const override;
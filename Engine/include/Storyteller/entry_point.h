@@ -35,7 +35,7 @@ int Main(const Storyteller::ProgramOptions& programOptions)
         return 1;
     }
 
-    if (!app->Initialize(programOptions.GetConfigPath()))
+    if (!app->Initialize(programOptions))
     {
         delete app;
         return 2;
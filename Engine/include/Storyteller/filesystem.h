@@ -1,6 +1,7 @@
 #pragma once
 
 #include <filesystem>
+#include <system_error>
 
 namespace Storyteller
 {
@@ -15,6 +16,8 @@ namespace Storyteller
         static bool PathExists(const std::filesystem::path& path);
         static bool FilePathIsValid(const std::filesystem::path& path);
         static bool CreatePathTree(const std::filesystem::path& path);
+        // flushes the source to disk before replacing the target with it, so a power loss leaves either file complete
+        static bool DurableRename(const std::filesystem::path& source, const std::filesystem::path& target, std::error_code& error);
 
         static std::string ToU8String(const std::filesystem::path& path);
         static std::string ToString(const std::filesystem::path& path);
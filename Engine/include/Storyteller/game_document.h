@@ -2,18 +2,30 @@
 
 #include "pointers.h"
 #include "uuid.h"
+#include "uuid_map.h"
 #include "entities.h"
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include <filesystem>
 
 namespace Storyteller
 {
+    struct Diagnostic;
+    class GameDocumentConsistencyCache;
+    class GameDocumentSearchIndex;
+
     class GameDocument
     {
     public:
         explicit GameDocument(const std::filesystem::path& path = "");
+        ~GameDocument();
+
+        // deep copy of the objects, names and references of the copy are indexed on its first lookup,
+        // so a copy that is only serialized never pays for them
+        Ptr<GameDocument> Clone() const;
 
         std::string GetGameName() const;
         void SetGameName(const std::string& gameName);
@@ -27,10 +39,22 @@ namespace Storyteller
 
         bool IsDirty() const;
         void SetDirty(bool dirty);
+        uint64_t GetRevision() const;
+
+        const std::unordered_set<UUID>& GetChangedObjects() const;
+        bool ArePropertiesChanged() const;
+        void ResetChanges();
 
         bool AddObject(ObjectType type, const UUID& uuid = UUID());
         bool AddObject(const Ptr<BasicObject>& object);
+        // objects of invalid types or with taken UUIDs are skipped, the rest are indexed on the first lookup
+        std::size_t AddObjects(const std::vector<Ptr<BasicObject>>& objects);
+        // references to the removed object are kept, so it can be replaced by an object with the same UUID;
+        // the storages keep insertion order, so it takes time linear to the objects count
         bool RemoveObject(const UUID& uuid);
+        // actions and targets referring to the removed objects are cleared, all as a single change,
+        // the storages are compacted once for the whole batch
+        std::size_t RemoveObjects(const std::vector<UUID>& uuids);
 
         Ptr<BasicObject> GetObject(const UUID& uuid) const;
         Ptr<BasicObject> GetObject(const std::string& name) const;
@@ -38,75 +62,86 @@ namespace Storyteller
         const std::vector<Ptr<BasicObject>>& GetObjects() const;
         std::vector<Ptr<BasicObject>> GetObjects(ObjectType type) const;
         template<typename T>
-        std::vector<Ptr<T>> GetObjects() const;
+        const std::vector<Ptr<T>>& GetObjects() const;
+
+        std::vector<UUID> GetActionsTargeting(const UUID& uuid) const;
+        std::vector<UUID> GetQuestsContaining(const UUID& actionUuid) const;
 
         void SetEntryPoint(const UUID& uuid);
         Ptr<BasicObject> GetEntryPoint() const;
         bool SetObjectName(const UUID& uuid, const std::string& name) const;
 
         bool CheckConsistency() const;
+        bool IsObjectConsistent(const UUID& uuid) const;
+        std::vector<Diagnostic> GetObjectDiagnostics(const UUID& uuid) const;
+        const std::vector<Diagnostic>& GetDiagnostics() const;
+
+        std::vector<Ptr<BasicObject>> FindObjects(const std::string& query) const;
+
+    private:
+        void InsertObject(const Ptr<BasicObject>& object);
+        void InsertObjects(const std::vector<Ptr<BasicObject>>& objects);
+        void StoreObject(const Ptr<BasicObject>& object);
+        void EraseObjects(const std::unordered_set<UUID>& uuids);
+        template<typename T>
+        static void EraseObjects(std::vector<Ptr<T>>& objects, const std::unordered_set<const BasicObject*>& erasedObjects);
+        void OnObjectChange(const ObjectChange& change);
+        void UpdateIndices(const ObjectChange& change);
+        void BuildIndices() const;
+        void IndexObjectReferences(const BasicObject& object) const;
+        void UnindexObjectReferences(const BasicObject& object);
+        static void UnindexReference(std::unordered_multimap<UUID, UUID>& index, const UUID& uuid, const UUID& referrerUuid);
+        static void UnindexReferences(std::unordered_multimap<UUID, UUID>& index, const std::unordered_set<UUID>& uuids, const std::unordered_set<UUID>& referrerUuids);
+        void IndexObjectName(const std::string& name, const UUID& uuid) const;
+        void UnindexObjectName(const std::string& name, const UUID& uuid);
+        std::string GenerateObjectName(ObjectType type);
 
     private:
         std::string _gameName;
         std::string _domainName;
         std::filesystem::path _path;
         bool _dirty;
+        uint64_t _revision;
+        std::unordered_set<UUID> _changedObjects;
+        bool _propertiesChanged;
         std::vector<Ptr<BasicObject>> _objects;
+        std::vector<Ptr<QuestObject>> _questObjects;
+        std::vector<Ptr<ActionObject>> _actionObjects;
+        std::vector<Ptr<TextObject>> _textObjects;
+        UuidMap<Ptr<BasicObject>> _objectsIndex;
+        // names and reverse edges are dropped by bulk insertions and rebuilt by the first lookup
+        mutable bool _indicesBuilt;
+        mutable std::unordered_multimap<std::string, UUID> _namesIndex;
+        // reverse edges of the quest graph, kept for missing targets and actions too
+        mutable std::unordered_multimap<UUID, UUID> _targetingActions;
+        mutable std::unordered_multimap<UUID, UUID> _containingQuests;
+        bool _removingObjects;
+        std::unordered_map<ObjectType, unsigned int> _nextNameIndices;
         UUID _entryPointUuid;
+        // refreshed lazily by the const getters
+        const UPtr<GameDocumentConsistencyCache> _consistencyCache;
+        const UPtr<GameDocumentSearchIndex> _searchIndex;
     };
     //--------------------------------------------------------------------------
 
     template<>
-    inline std::vector<Ptr<QuestObject>> GameDocument::GetObjects() const
+    inline const std::vector<Ptr<QuestObject>>& GameDocument::GetObjects() const
     {
-        const auto basicObjects = GetObjects(ObjectType::QuestObjectType);
-        std::vector<Ptr<QuestObject>> result;
-        std::for_each(basicObjects.cbegin(), basicObjects.cend(), [&](const Ptr<BasicObject>& object) {
-            const auto typedObject = std::dynamic_pointer_cast<QuestObject>(object);
-            if (typedObject)
-            {
-                result.push_back(typedObject);
-            }
-            }
-        );
-
-        return result;
+        return _questObjects;
     }
     //--------------------------------------------------------------------------
 
     template<>
-    inline std::vector<Ptr<ActionObject>> GameDocument::GetObjects() const
+    inline const std::vector<Ptr<ActionObject>>& GameDocument::GetObjects() const
     {
-        const auto basicObjects = GetObjects(ObjectType::ActionObjectType);
-        std::vector<Ptr<ActionObject>> result;
-        std::for_each(basicObjects.cbegin(), basicObjects.cend(), [&](const Ptr<BasicObject>& object) {
-            const auto typedObject = std::dynamic_pointer_cast<ActionObject>(object);
-            if (typedObject)
-            {
-                result.push_back(typedObject);
-            }
-            }
-        );
-
-        return result;
+        return _actionObjects;
     }
     //--------------------------------------------------------------------------
 
     template<>
-    inline std::vector<Ptr<TextObject>> GameDocument::GetObjects() const
+    inline const std::vector<Ptr<TextObject>>& GameDocument::GetObjects() const
     {
-        const auto& basicObjects = GetObjects();
-        std::vector<Ptr<TextObject>> result;
-        std::for_each(basicObjects.cbegin(), basicObjects.cend(), [&](const Ptr<BasicObject>& object) {
-            const auto textObject = std::dynamic_pointer_cast<TextObject>(object);
-            if (textObject)
-            {
-                result.push_back(textObject);
-            }
-            }
-        );
-
-        return result;
+        return _textObjects;
     }
     //--------------------------------------------------------------------------
-}
+}
\ No newline at end of file
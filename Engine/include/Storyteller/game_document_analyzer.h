@@ -0,0 +1,130 @@
+#pragma once
+
+#include "uuid.h"
+#include "game_document.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <cstdint>
+
+namespace Storyteller
+{
+    enum class DiagnosticType
+    {
+        EmptyNameType,
+        EmptyTextType,
+        NoActionsType,
+        FinalWithActionsType,
+        MissingEntryPointType,
+        EntryPointNotQuestType,
+        NoTargetType,
+        DanglingTargetType,
+        NonQuestTargetType,
+        DanglingActionType,
+        NonActionType,
+        UnreachableQuestType,
+        NonTerminatingQuestType
+    };
+
+    std::string DiagnosticTypeToString(DiagnosticType type);
+    //--------------------------------------------------------------------------
+
+    struct Diagnostic
+    {
+        DiagnosticType type;
+        // object the problem is found in, invalid for document-wide problems
+        UUID uuid;
+        // missing or mistyped action, target or entry point
+        UUID relatedUuid;
+    };
+    //--------------------------------------------------------------------------
+
+    // Quest to quest edges in compressed form, walked forward from the entry quest
+    // and backwards from the final quests
+    class QuestGraphWalker
+    {
+    public:
+        typedef uint32_t Index;
+        typedef std::pair<Index, Index> Edge;
+
+    public:
+        QuestGraphWalker(Index questsCount, const std::vector<Edge>& edges);
+
+        std::vector<bool> FindReachable(Index entryQuest) const;
+        // quests with a path to one of the final quests
+        std::vector<bool> FindTerminating(const std::vector<Index>& finalQuests) const;
+
+    private:
+        static void Walk(const std::vector<Index>& offsets, const std::vector<Index>& adjacency, std::vector<bool>& visited, std::vector<Index>& pending);
+
+    private:
+        // neighbours of quest i are adjacency[offsets[i]..offsets[i + 1])
+        std::vector<Index> _forwardOffsets;
+        std::vector<Index> _forwardEdges;
+        std::vector<Index> _reverseOffsets;
+        std::vector<Index> _reverseEdges;
+    };
+    //--------------------------------------------------------------------------
+
+    // Validates the whole quest/action graph of a document in time linear to its size
+    class GameDocumentAnalyzer
+    {
+    public:
+        explicit GameDocumentAnalyzer(const GameDocument& document);
+
+        std::vector<Diagnostic> Analyze() const;
+
+        // problems of a single object and the objects it refers to
+        void AnalyzeObject(const BasicObject& object, std::vector<Diagnostic>& diagnostics) const;
+        // entry point, reachability and termination problems of the document
+        void AnalyzeGraph(std::vector<Diagnostic>& diagnostics) const;
+
+    private:
+        typedef uint32_t Index;
+        static constexpr Index InvalidIndex = Index(-1);
+
+    private:
+        void AnalyzeQuest(const QuestObject& questObject, std::vector<Diagnostic>& diagnostics) const;
+        void AnalyzeAction(const ActionObject& actionObject, std::vector<Diagnostic>& diagnostics) const;
+
+    private:
+        const GameDocument& _document;
+    };
+    //--------------------------------------------------------------------------
+
+    // Keeps diagnostics of a document up to date between changes,
+    // only invalidated objects and the objects referring to them are analyzed again
+    class GameDocumentConsistencyCache
+    {
+    public:
+        explicit GameDocumentConsistencyCache(const GameDocument& document);
+
+        void InvalidateObject(const UUID& uuid, bool structural);
+        void InvalidateReferrers(const UUID& uuid);
+        void InvalidateGraph();
+
+        bool IsConsistent(const UUID& uuid);
+        std::vector<Diagnostic> GetDiagnostics(const UUID& uuid);
+        const std::vector<Diagnostic>& GetDiagnostics();
+
+    private:
+        void Update();
+        void AnalyzeObject(const UUID& uuid);
+        void AnalyzeGraph();
+
+    private:
+        const GameDocument& _document;
+        bool _rebuild;
+        bool _graphDirty;
+        bool _diagnosticsDirty;
+        std::unordered_set<UUID> _dirtyObjects;
+        // only objects with problems have an entry, document-wide problems are kept under the invalid UUID
+        std::unordered_map<UUID, std::vector<Diagnostic>> _objectDiagnostics;
+        std::unordered_map<UUID, std::vector<Diagnostic>> _graphDiagnostics;
+        std::vector<Diagnostic> _diagnostics;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
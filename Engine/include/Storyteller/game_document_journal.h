@@ -0,0 +1,38 @@
+#pragma once
+
+#include "game_document.h"
+
+#include <filesystem>
+#include <cstdint>
+
+namespace Storyteller
+{
+    // Append-only log of document changes stored next to the document file,
+    // each line is a JSON record of a changed object, a removed object or document properties
+    class GameDocumentJournal
+    {
+    public:
+        explicit GameDocumentJournal(const std::filesystem::path& documentPath);
+
+        bool Append(GameDocument& document) const;
+        bool Replay(GameDocument& document) const;
+
+        bool Rotate() const;
+        bool RestoreRotated() const;
+        void RemoveRotated() const;
+        bool Relocate(const std::filesystem::path& documentPath) const;
+        void Discard() const;
+
+        std::uintmax_t GetSize() const;
+
+    private:
+        bool ReplayFile(const std::filesystem::path& path, GameDocument& document, bool& intact) const;
+        void RemoveDamagedRecords(const std::filesystem::path& path) const;
+        bool AppendFile(const std::filesystem::path& from, const std::filesystem::path& to) const;
+
+    private:
+        const std::filesystem::path _path;
+        const std::filesystem::path _rotatedPath;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
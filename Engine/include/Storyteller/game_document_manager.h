@@ -5,12 +5,25 @@
 #include "game_document_sort_filter_proxy_view.h"
 #include "i18n_manager.h"
 
+#include <future>
+#include <atomic>
+
 namespace Storyteller
 {
     class GameDocumentManager
     {
+    public:
+        enum class SaveState
+        {
+            IdleState,
+            SavingState,
+            SucceededState,
+            FailedState
+        };
+
     public:
         explicit GameDocumentManager(const Ptr<I18N::Manager> i18nManager);
+        ~GameDocumentManager();
 
         void NewDocument();
         bool OpenDocument(const std::filesystem::path& path);
@@ -19,18 +32,32 @@ namespace Storyteller
         bool Save() const;
         bool Save(const std::filesystem::path& path) const;
 
+        bool Autosave();
+        void DiscardJournal() const;
+
+        bool SaveAsync();
+        bool SaveAsync(const std::filesystem::path& path);
+        void UpdateAsyncSave();
+        SaveState GetSaveState() const;
+        float GetSaveProgress() const;
+
         Ptr<GameDocument> GetDocument() const;
         Ptr<GameDocumentSortFilterProxyView> GetProxy();
 
         bool CreateTranslations(const std::filesystem::path& path) const;
 
-    private:
-        void FillDictionary() const;
-
     private:
         const Ptr<I18N::Manager> _i18nManager;
         Ptr<GameDocument> _document;
         Ptr<GameDocumentSortFilterProxyView> _proxy;
+
+        Ptr<GameDocument> _savingDocument;
+        std::filesystem::path _savingPath;
+        std::filesystem::path _savingJournalPath;
+        uint64_t _savingRevision;
+        SaveState _saveState;
+        std::atomic<float> _saveProgress;
+        std::future<bool> _saveResult;
     };
     //--------------------------------------------------------------------------
 }
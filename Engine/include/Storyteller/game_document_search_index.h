@@ -0,0 +1,68 @@
+#pragma once
+
+#include "pointers.h"
+#include "uuid.h"
+#include "entities.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
+
+namespace Storyteller
+{
+    class GameDocument;
+
+    // Trigram index over object names and texts for case-insensitive substring search,
+    // built on the first search and then updated only for invalidated objects
+    class GameDocumentSearchIndex
+    {
+    public:
+        explicit GameDocumentSearchIndex(const GameDocument& document);
+
+        void InvalidateObject(const UUID& uuid);
+
+        std::vector<Ptr<BasicObject>> Find(const std::string& query);
+
+        static bool Matches(const BasicObject& object, const std::string& query);
+
+    private:
+        typedef uint32_t Slot;
+        typedef uint32_t Trigram;
+
+        struct Entry
+        {
+            Ptr<BasicObject> object;
+            uint32_t trigramsCount;
+            uint32_t queryStamp;
+        };
+
+    private:
+        void Update();
+        void Rebuild();
+        void IndexObject(const Ptr<BasicObject>& object);
+        void UnindexObject(const UUID& uuid);
+
+        static std::string ToLower(std::string_view string);
+        static bool ContainsLowered(std::string_view string, std::string_view loweredQuery);
+        static bool MatchesLowered(const BasicObject& object, std::string_view loweredQuery);
+        static void CollectTrigrams(std::string_view string, std::vector<Trigram>& trigrams);
+
+    private:
+        const GameDocument& _document;
+        bool _rebuild;
+        std::unordered_set<UUID> _dirtyObjects;
+        std::unordered_map<UUID, Slot> _slots;
+        std::vector<Entry> _entries;
+        std::vector<Slot> _freeSlots;
+        // postings are only appended to, entries left by changed or removed objects are dropped by the next rebuild
+        std::unordered_map<Trigram, std::vector<Slot>> _postings;
+        std::size_t _livePostingsCount;
+        std::size_t _stalePostingsCount;
+        uint32_t _queryStamp;
+        std::vector<Trigram> _trigrams;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
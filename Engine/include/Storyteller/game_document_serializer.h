@@ -4,24 +4,37 @@
 #include "game_document.h"
 
 #include <filesystem>
+#include <functional>
 
 namespace Storyteller
 {
     class GameDocumentSerializer
     {
+    public:
+        typedef std::function<void(float)> ProgressCallback;
+
     public:
         explicit GameDocumentSerializer(const Ptr<GameDocument> document);
 
+        void SetProgressCallback(const ProgressCallback& progressCallback);
+
         bool Load(const std::filesystem::path& path);
         bool Save();
         bool Save(const std::filesystem::path& path);
 
+        static bool IsBinaryPath(const std::filesystem::path& path);
+
     private:
         bool Serialize(const std::filesystem::path& path) const;
         bool Deserialize(const std::filesystem::path& path);
+        bool SerializeBinary(const std::filesystem::path& path) const;
+        bool DeserializeBinary(const std::filesystem::path& path);
+
+        void ReportProgress(std::size_t current, std::size_t total) const;
 
     private:
         const Ptr<GameDocument> _document;
+        ProgressCallback _progressCallback;
     };
     //--------------------------------------------------------------------------
 }
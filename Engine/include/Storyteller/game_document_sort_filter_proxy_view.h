@@ -4,8 +4,10 @@
 #include "uuid.h"
 #include "entities.h"
 #include "game_document.h"
+#include "game_document_analyzer.h"
 
 #include <set>
+#include <unordered_set>
 
 namespace Storyteller
 {
@@ -22,12 +24,15 @@ namespace Storyteller
             };
 
             Sorter() = default;
-            Sorter(bool ascending, SortValue sortValue);
+            Sorter(bool ascending, SortValue sortValue, bool localeAware = false);
 
             bool operator()(const Ptr<BasicObject>& a, const Ptr<BasicObject>& b) const;
+            int CompareNames(const std::string& a, const std::string& b) const;
 
             SortValue sortValue = Type;
             bool ascending = false;
+            // names are collated by the global locale instead of compared bytewise
+            bool localeAware = false;
             bool active = false;
         };
 
@@ -35,10 +40,13 @@ namespace Storyteller
         {
             Filter();
 
-            bool Accept(ObjectType type) const;
+            bool Accept(const BasicObject& object) const;
             bool NeedFilter() const;
 
             std::set<ObjectType> filterTypes;
+            // objects found by the search query, all objects pass when there is no query
+            std::string query;
+            std::unordered_set<UUID> matches;
             bool active;
         };
 
@@ -50,20 +58,27 @@ namespace Storyteller
         bool AddObject(ObjectType type, const UUID& uuid = UUID());
         bool AddObject(const Ptr<BasicObject>& object);
         bool RemoveObject(const UUID& uuid);
+        std::size_t RemoveObjects(const std::vector<UUID>& uuids);
         Ptr<BasicObject> GetObject(const UUID& uuid) const;
         Ptr<BasicObject> GetObject(const std::string& name) const;
 
         const std::vector<Ptr<BasicObject>>& GetObjects() const;
         std::vector<Ptr<BasicObject>> GetObjects(ObjectType type) const;
         template<typename T>
-        std::vector<Ptr<T>> GetObjects() const
+        const std::vector<Ptr<T>>& GetObjects() const
         {
             return _document->GetObjects<T>();
         }
 
         void SetEntryPoint(const UUID& uuid);
         Ptr<BasicObject> GetEntryPoint() const;
-        bool SetObjectName(const UUID& uuid, const std::string& name) const;
+        bool SetObjectName(const UUID& uuid, const std::string& name);
+        bool SetObjectText(const UUID& uuid, const std::string& text);
+
+        bool IsConsistent(const UUID& uuid) const;
+        std::vector<Diagnostic> GetDiagnostics(const UUID& uuid) const;
+        std::vector<UUID> GetActionsTargeting(const UUID& uuid) const;
+        std::vector<UUID> GetQuestsContaining(const UUID& actionUuid) const;
 
         void Select(const UUID& uuid);
         bool IsSelected(const UUID& uuid) const;
@@ -71,17 +86,25 @@ namespace Storyteller
         Ptr<BasicObject> GetSelectedObject() const;
 
         void UpdateCache();
-        void DoSort(bool ascending, Sorter::SortValue sortValue);
+        void DoSort(bool ascending, Sorter::SortValue sortValue, bool localeAware = false);
         void DoFilter(ObjectType type, bool accept);
+        void DoSearch(const std::string& query);
+        const std::string& GetSearchQuery() const;
 
     private:
-        void UpdateView();
         void DoSort();
         void DoFilter();
+        void InsertObject(const Ptr<BasicObject>& object);
+        void EraseObject(const Ptr<BasicObject>& object);
+        std::vector<Ptr<BasicObject>>::iterator FindPosition(std::vector<Ptr<BasicObject>>& objects, const Ptr<BasicObject>& object) const;
+        std::vector<Ptr<BasicObject>>::iterator FindInsertPosition(std::vector<Ptr<BasicObject>>& objects, const Ptr<BasicObject>& object) const;
 
     private:
         const Ptr<GameDocument> _document;
+        // all objects in sort order, the cache is its filtered subset
+        std::vector<Ptr<BasicObject>> _sortedObjects;
         std::vector<Ptr<BasicObject>> _cache;
+        std::vector<Ptr<BasicObject>> _searchResults;
         UUID _selectedUuid;
         Sorter _sorter;
         Filter _filter;
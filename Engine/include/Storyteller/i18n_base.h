@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
 
 namespace Storyteller
 {
@@ -10,6 +13,7 @@ namespace Storyteller
         static constexpr auto TranslateCtxKeyword = "TranslateCtx";
         static constexpr auto TranslateDeferKeyword = "TranslateDefer";
         static constexpr auto TranslateCtxDeferKeyword = "TranslateCtxDefer";
+        static constexpr auto TranslateHandleKeyword = "TranslateHandle";
 
         static constexpr auto LocaleEnUTF8Keyword = "en_EN.UTF-8";
         static constexpr auto LocaleEnName = "English";
@@ -22,6 +26,22 @@ namespace Storyteller
         typedef std::string SourceStr;
         typedef std::string TranslationStr;
 
+        // index of a message registered in a lookup dictionary
+        typedef uint32_t MessageId;
+        static constexpr MessageId InvalidMessageId = MessageId(-1);
+
+        // hashes std::string keys and string_view lookups alike, so lookups don't allocate
+        struct StringHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view string) const
+            {
+                return std::hash<std::string_view>{}(string);
+            }
+        };
+        //--------------------------------------------------------------------------
+
         struct ContextedSource
         {
             SourceStr source;
@@ -34,14 +54,43 @@ namespace Storyteller
         };
         //--------------------------------------------------------------------------
 
+        // non-owning lookup key for maps of ContextedSource
+        struct ContextedSourceView
+        {
+            std::string_view source;
+            std::string_view context;
+        };
+        //--------------------------------------------------------------------------
+
         struct ContextedSourceHash
         {
+            using is_transparent = void;
+
             std::size_t operator()(const ContextedSource& p) const
             {
-                const auto hs = std::hash<SourceStr>{}(p.source);
-                const auto hc = std::hash<ContextStr>{}(p.context);
+                return operator()(ContextedSourceView{ p.source, p.context });
+            }
+
+            std::size_t operator()(const ContextedSourceView& p) const
+            {
+                // order dependent combine, a plain xor maps equal pairs to 0 and swapped pairs to the same bucket
+                auto hash = std::hash<std::string_view>{}(p.source);
+                const auto hc = std::hash<std::string_view>{}(p.context);
+                hash ^= hc + std::size_t(0x9e3779b97f4a7c15ull) + (hash << 6) + (hash >> 2);
 
-                return hs ^ hc;
+                return hash;
+            }
+        };
+        //--------------------------------------------------------------------------
+
+        struct ContextedSourceEqual
+        {
+            using is_transparent = void;
+
+            template<typename L, typename R>
+            bool operator()(const L& lhs, const R& rhs) const
+            {
+                return lhs.source == rhs.source && lhs.context == rhs.context;
             }
         };
         //--------------------------------------------------------------------------
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "i18n_base.h"
+#include "memory_mapped_file.h"
+
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+#include <cstdint>
+
+namespace Storyteller
+{
+    namespace I18N
+    {
+        namespace CatalogFormat
+        {
+            struct Header;
+            struct StringRef;
+            struct MessageRecord;
+        }
+
+        // Translations of a domain for all its locales, compiled from .po files and read in place from a mapped file
+        class Catalog
+        {
+        public:
+            static constexpr uint32_t InvalidLocale = uint32_t(-1);
+
+        public:
+            bool Open(const std::filesystem::path& path);
+            void Close();
+
+            bool IsOpen() const;
+            bool HasPlurals() const;
+
+            // locales are matched by name without the encoding, e.g. 'ru_RU' for 'ru_RU.UTF-8'
+            uint32_t FindLocale(const LocaleStr& locale) const;
+            // empty if the message is missing or not translated for the locale
+            std::string_view Find(uint32_t locale, std::string_view source, std::string_view context = {}) const;
+
+        private:
+            std::string_view GetString(const CatalogFormat::StringRef& string) const;
+
+        private:
+            MemoryMappedFile _file;
+            const CatalogFormat::Header* _header = nullptr;
+            const CatalogFormat::StringRef* _locales = nullptr;
+            const uint32_t* _seeds = nullptr;
+            const CatalogFormat::MessageRecord* _messages = nullptr;
+            const CatalogFormat::StringRef* _translations = nullptr;
+            const char* _strings = nullptr;
+        };
+        //--------------------------------------------------------------------------
+
+        // Collects translations of a domain and writes them as a catalog
+        class CatalogBuilder
+        {
+        public:
+            bool AddPoFile(const LocaleStr& locale, const std::filesystem::path& path);
+            void Add(const LocaleStr& locale, const SourceStr& source, const ContextStr& context, const TranslationStr& translation);
+
+            bool Write(const std::filesystem::path& path) const;
+
+        private:
+            struct Message
+            {
+                SourceStr source;
+                ContextStr context;
+                std::vector<TranslationStr> translations;
+            };
+
+        private:
+            std::size_t GetLocaleIndex(const LocaleStr& locale);
+
+        private:
+            std::vector<LocaleStr> _locales;
+            std::vector<Message> _messages;
+            std::unordered_map<ContextedSource, std::size_t, ContextedSourceHash, ContextedSourceEqual> _messagesIndex;
+            bool _hasPlurals = false;
+        };
+        //--------------------------------------------------------------------------
+    }
+}
\ No newline at end of file
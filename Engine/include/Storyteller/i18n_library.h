@@ -3,6 +3,7 @@
 #include "i18n_base.h"
 #include "pointers.h"
 
+#include <string_view>
 #include <unordered_map>
 
 namespace Storyteller
@@ -24,11 +25,11 @@ namespace Storyteller
 
             void Add(const DomainStr& domain, const SourceStr& source, const TranslationStr& translation);
             void Add(const DomainStr& domain, const SourceStr& source, const ContextStr& context, const TranslationStr& translation);
-            const TranslationStr& Get(const DomainStr& domain, const SourceStr& source);
-            const TranslationStr& Get(const DomainStr& domain, const SourceStr& source, const ContextStr& context);
+            const TranslationStr& Get(std::string_view domain, std::string_view source) const;
+            const TranslationStr& Get(std::string_view domain, std::string_view source, std::string_view context) const;
 
         private:
-            std::unordered_map<DomainStr, Ptr<LookupDictionary>> _lookupDictionaries;
+            std::unordered_map<DomainStr, Ptr<LookupDictionary>, StringHash, std::equal_to<>> _lookupDictionaries;
             LocaleStr _currentLocale;
         };
         //--------------------------------------------------------------------------
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "i18n_base.h"
+#include "i18n_catalog.h"
+#include "pointers.h"
 
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace Storyteller
 {
@@ -18,20 +22,42 @@ namespace Storyteller
 
             void Add(const SourceStr& source, const TranslationStr& translation);
             void Add(const SourceStr& source, const ContextStr& context, const TranslationStr& translation);
-            const TranslationStr& Get(const SourceStr& source);
-            const TranslationStr& Get(const SourceStr& source, const ContextStr& context);
+            // empty string for a missing translation
+            const TranslationStr& Get(std::string_view source) const;
+            const TranslationStr& Get(std::string_view source, std::string_view context) const;
+
+            // registered messages are resolved once per locale, so getting them by id is a plain array access
+            MessageId Register(std::string_view source);
+            const TranslationStr& Get(MessageId id) const;
+
+            // compiled translations of the domain, used instead of the locale generator when set
+            void SetCatalog(const Ptr<Catalog>& catalog);
+            bool HasCatalog() const;
+            // source for a message missing in the catalog
+            TranslationStr TranslateFromCatalog(std::string_view source) const;
+            TranslationStr TranslateFromCatalog(std::string_view source, std::string_view context) const;
 
         private:
-            typedef std::unordered_map<SourceStr, TranslationStr> Translations;
-            typedef std::unordered_map<ContextedSource, TranslationStr, ContextedSourceHash> ContextedTranslations;
+            typedef std::unordered_map<SourceStr, TranslationStr, StringHash, std::equal_to<>> Translations;
+            typedef std::unordered_map<ContextedSource, TranslationStr, ContextedSourceHash, ContextedSourceEqual> ContextedTranslations;
             typedef std::unordered_map<LocaleStr, Translations> LocalizedTranslations;
             typedef std::unordered_map<LocaleStr, ContextedTranslations> LocalizedContextedTranslations;
+            typedef std::vector<const TranslationStr*> Messages;
 
         private:
             const DomainStr _domain;
             LocaleStr _currentLocaleString;
             LocalizedTranslations _translations;
             LocalizedContextedTranslations _translationsWithContext;
+            // tables of the current locale, resolved once per locale change
+            Translations* _currentTranslations;
+            ContextedTranslations* _currentTranslationsWithContext;
+            std::unordered_map<SourceStr, MessageId, StringHash, std::equal_to<>> _messageIds;
+            std::vector<const SourceStr*> _messageSources;
+            std::unordered_map<LocaleStr, Messages> _localizedMessages;
+            Messages* _currentMessages;
+            Ptr<Catalog> _catalog;
+            uint32_t _catalogLocale;
         };
         //--------------------------------------------------------------------------
     }
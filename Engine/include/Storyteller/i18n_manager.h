@@ -9,6 +9,8 @@
 #include <boost/locale.hpp>
 
 #include <functional>
+#include <vector>
+#include <future>
 
 namespace Storyteller
 {
@@ -23,6 +25,7 @@ namespace Storyteller
 
         public:
             explicit Manager(const LocaleStr& defaultLocale = "", const std::string& defaultPath = Filesystem::ToString(Filesystem::GetCurrentPath().append("locale")));
+            ~Manager();
 
             void SetLocale(const LocaleStr& localeString);
             const LocaleStr& GetLocale() const;
@@ -41,6 +44,8 @@ namespace Storyteller
             TranslationStr Translate(const DomainStr& domain, const SourceStr& messageSingular, const SourceStr& messagePlural, int count);
             TranslationStr TranslateCtx(const DomainStr& domain, const SourceStr& message, const ContextStr& context);
             TranslationStr TranslateCtx(const DomainStr& domain, const SourceStr& messageSingular, const SourceStr& messagePlural, int count, const ContextStr& context);
+            // translates the message and registers it in the domain's lookup dictionary, invalid id if the domain is not added
+            MessageId TranslateHandle(const DomainStr& domain, const SourceStr& message);
 
             static void TranslateDefer(const DomainStr& domain, const SourceStr& message) {};
             static void TranslateDefer(const DomainStr& domain, const SourceStr& messageSingular, const SourceStr& messagePlural, int count) {};
@@ -53,15 +58,33 @@ namespace Storyteller
             const TranslationStr& TranslationOr(const DomainStr& domain, const SourceStr& message, const ContextStr& context, const TranslationStr& defaultString);
             const TranslationStr& TranslationOrSource(const DomainStr& domain, const SourceStr& message);
             const TranslationStr& TranslationOrSource(const DomainStr& domain, const SourceStr& message, const ContextStr& context);
+            // translated on the first access and memoized in the domain's lookup dictionary for the current locale
+            const TranslationStr& TranslationLazy(const DomainStr& domain, const SourceStr& message);
+            // translates the messages on a worker thread, the results are memoized once it is finished
+            void Prefetch(const DomainStr& domain, std::vector<SourceStr> messages);
+
+        private:
+            struct Prefetched
+            {
+                DomainStr domain;
+                std::vector<std::pair<SourceStr, TranslationStr>> translations;
+            };
 
         private:
             void NotifyLocaleListeners() const;
+            void FinishPrefetch();
+            // catalog or generator translation, leaves the lookup dictionary untouched
+            static TranslationStr Lookup(const LookupDictionary* dictionary, const DomainStr& domain, const SourceStr& message);
+            // the domain's compiled catalog from the messages paths, null if there is none
+            Ptr<Catalog> LoadCatalog(const DomainStr& domain) const;
 
         private:
             boost::locale::generator _localeGenerator;
             Ptr<Library> _library;
             LocaleStr _currentLocale;
+            std::vector<std::string> _messagesPaths;
             std::vector<LocaleChangeCallback> _localeChangedCallbacks;
+            std::future<Prefetched> _prefetched;
         };
         //--------------------------------------------------------------------------
     }
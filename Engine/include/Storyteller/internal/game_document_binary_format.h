@@ -0,0 +1,57 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#define STRTLR_BINARY_DOCUMENT_EXTENSION ".strtlr"
+
+namespace Storyteller
+{
+    // Binary game document layout, all values are little-endian:
+    // [Header][ObjectRecord * objectsCount][uint64 action uuid * actionsCount][string table]
+    // Strings are referenced by offset and size into the string table and are not null-terminated
+    namespace BinaryFormat
+    {
+        // records are written and mapped as native structs, which matches the format only on little-endian hosts
+        static_assert(std::endian::native == std::endian::little, "binary document format requires a little-endian host");
+
+        constexpr char Magic[4] = { 'S', 'T', 'G', 'D' };
+        constexpr uint32_t Version = 1;
+
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            uint64_t entryPointUuid;
+            uint64_t objectsOffset;
+            uint64_t objectsCount;
+            uint64_t actionsOffset;
+            uint64_t actionsCount;
+            uint64_t stringsOffset;
+            uint64_t stringsSize;
+            uint32_t gameNameOffset;
+            uint32_t gameNameSize;
+            uint32_t domainNameOffset;
+            uint32_t domainNameSize;
+        };
+        static_assert(sizeof(Header) == 80);
+        //--------------------------------------------------------------------------
+
+        struct ObjectRecord
+        {
+            uint64_t uuid;
+            uint64_t targetUuid;
+            uint32_t nameOffset;
+            uint32_t nameSize;
+            uint32_t textOffset;
+            uint32_t textSize;
+            uint32_t actionsIndex;
+            uint32_t actionsCount;
+            uint8_t objectType;
+            uint8_t final;
+            uint8_t padding[6];
+        };
+        static_assert(sizeof(ObjectRecord) == 48);
+        //--------------------------------------------------------------------------
+    }
+}
\ No newline at end of file
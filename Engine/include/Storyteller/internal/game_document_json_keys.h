@@ -0,0 +1,14 @@
+#pragma once
+
+#define JSON_KEY_GAME_NAME "GameName"
+#define JSON_KEY_GAME_DOMAIN_NAME "GameDomainName"
+#define JSON_KEY_ENTRY_POINT_UUID "EntryPointUuid"
+#define JSON_KEY_OBJECTS "Objects"
+#define JSON_KEY_UUID "UUID"
+#define JSON_KEY_NAME "Name"
+#define JSON_KEY_OBJECT_TYPE "ObjectType"
+#define JSON_KEY_TEXT "Text"
+#define JSON_KEY_ACTIONS "Actions"
+#define JSON_KEY_TARGET "Target"
+#define JSON_KEY_FINAL "Final"
+#define JSON_KEY_REMOVED "Removed"
\ No newline at end of file
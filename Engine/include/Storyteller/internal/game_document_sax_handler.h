@@ -0,0 +1,69 @@
+#pragma once
+
+#include "pointers.h"
+#include "game_document.h"
+
+#include <rapidjson/reader.h>
+
+#include <string>
+#include <vector>
+
+namespace Storyteller
+{
+    // Builds game document objects directly from rapidjson reader events,
+    // only the object being read is kept in memory
+    class GameDocumentSaxHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, GameDocumentSaxHandler>
+    {
+    public:
+        explicit GameDocumentSaxHandler(const Ptr<GameDocument> document);
+
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+        bool IsFinished() const;
+
+    private:
+        enum class State
+        {
+            StartState,
+            DocumentState,
+            ObjectsState,
+            ObjectState,
+            ActionsState,
+            FinishState
+        };
+
+        struct PendingObject
+        {
+            uint64_t uuid;
+            std::string name;
+            std::string objectType;
+            std::string text;
+            std::vector<UUID> actions;
+            uint64_t target;
+            bool final;
+        };
+
+    private:
+        bool OnUInt64(uint64_t value);
+        bool OnUnexpectedContainer();
+        bool FinishObject();
+
+    private:
+        const Ptr<GameDocument> _document;
+        State _state;
+        std::string _key;
+        int _skipDepth;
+        PendingObject _pendingObject;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string_view>
+#include <bit>
+#include <cstdint>
+
+#define STRTLR_TRANSLATION_CATALOG_EXTENSION ".stc"
+
+namespace Storyteller
+{
+    namespace I18N
+    {
+        // Compiled translation catalog layout, all values are little-endian:
+        // [Header][StringRef locale name * localesCount][uint32 seed * bucketsCount, padded to 8 bytes]
+        // [MessageRecord * messagesCount][StringRef translation * messagesCount * localesCount][string table]
+        // Messages are placed by a minimal perfect hash: the key hash selects a bucket, the bucket's seed selects the slot
+        namespace CatalogFormat
+        {
+            static_assert(std::endian::native == std::endian::little, "catalogs are read in place, so the host byte order must match the format");
+
+            constexpr char Magic[4] = { 'S', 'T', 'T', 'C' };
+            constexpr uint32_t Version = 1;
+
+            // plural messages are not compiled, their domain still needs the .mo files
+            constexpr uint32_t HasPluralsFlag = 1u << 0;
+            // seeds with this bit hold the slot itself, used for buckets of a single message
+            constexpr uint32_t DirectSlotFlag = 1u << 31;
+
+            struct Header
+            {
+                char magic[4];
+                uint32_t version;
+                uint32_t flags;
+                uint32_t hashSalt;
+                uint32_t localesCount;
+                uint32_t messagesCount;
+                uint32_t bucketsCount;
+                uint32_t padding;
+                uint64_t localesOffset;
+                uint64_t seedsOffset;
+                uint64_t messagesOffset;
+                uint64_t translationsOffset;
+                uint64_t stringsOffset;
+                uint64_t stringsSize;
+            };
+            static_assert(sizeof(Header) == 80);
+            //--------------------------------------------------------------------------
+
+            struct StringRef
+            {
+                uint32_t offset;
+                uint32_t size;
+            };
+            static_assert(sizeof(StringRef) == 8);
+            //--------------------------------------------------------------------------
+
+            struct MessageRecord
+            {
+                uint64_t hash;
+                StringRef source;
+                StringRef context;
+            };
+            static_assert(sizeof(MessageRecord) == 24);
+            //--------------------------------------------------------------------------
+
+            inline uint64_t Mix(uint64_t value)
+            {
+                value ^= value >> 33;
+                value *= 0xff51afd7ed558ccdull;
+                value ^= value >> 33;
+                value *= 0xc4ceb9fe1a85ec53ull;
+                value ^= value >> 33;
+                return value;
+            }
+            //--------------------------------------------------------------------------
+
+            // FNV-1a over the context, gettext's EOT separator and the source
+            inline uint64_t HashMessage(std::string_view source, std::string_view context, uint32_t salt)
+            {
+                auto hash = 14695981039346656037ull ^ Mix(salt);
+                const auto hashBytes = [&hash](std::string_view bytes) {
+                    for (const auto byte : bytes)
+                    {
+                        hash = (hash ^ uint8_t(byte)) * 1099511628211ull;
+                    }
+                };
+
+                hashBytes(context);
+                hashBytes(std::string_view("\x04", 1));
+                hashBytes(source);
+
+                return Mix(hash);
+            }
+            //--------------------------------------------------------------------------
+
+            inline uint32_t GetBucket(uint64_t hash, uint32_t bucketsCount)
+            {
+                return uint32_t(hash % bucketsCount);
+            }
+            //--------------------------------------------------------------------------
+
+            inline uint32_t GetSlot(uint64_t hash, uint32_t seed, uint32_t messagesCount)
+            {
+                return (seed & DirectSlotFlag) ? (seed & ~DirectSlotFlag) : uint32_t(Mix(hash ^ (uint64_t(seed) << 32 | seed)) % messagesCount);
+            }
+            //--------------------------------------------------------------------------
+        }
+    }
+}
\ No newline at end of file
@@ -41,6 +41,14 @@ namespace Storyteller
         std::string GetString(int index, const std::string& defaultValue = "");
         std::string GetString(const std::string& name, const std::string& defaultValue = "");
 
+    private:
+        struct ScopeEntry
+        {
+            rapidjson::Value* parent;
+            const char* name;
+            int index;
+        };
+
     private:
         std::string GetCurrentScopeString() const;
         bool ValidToGetFromArray(int index) const;
@@ -49,8 +57,7 @@ namespace Storyteller
         const std::filesystem::path _path;
 
         rapidjson::Document _document;
-        std::vector<std::string> _scope;
-        std::string _scopeString;
+        std::vector<ScopeEntry> _scope;
         rapidjson::Value* _currentObject;
     };
     //--------------------------------------------------------------------------
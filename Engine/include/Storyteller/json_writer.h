@@ -3,9 +3,11 @@
 #include "filesystem.h"
 
 #include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
+#include <rapidjson/ostreamwrapper.h>
 
 #include <string>
+#include <vector>
+#include <fstream>
 
 namespace Storyteller
 {
@@ -13,6 +15,7 @@ namespace Storyteller
     {
     public:
         explicit JsonWriter(const std::filesystem::path& path);
+        ~JsonWriter();
 
         bool Start();
         bool End();
@@ -42,10 +45,18 @@ namespace Storyteller
         bool SaveString(const std::string& name, const std::string& value);
 
     private:
+        void DiscardOutput();
+
+    private:
+        static constexpr std::size_t OutputBufferSize = 64 * 1024;
+
         const std::filesystem::path _path;
+        const std::filesystem::path _temporaryPath;
 
-        rapidjson::StringBuffer _stringBuffer;
-        rapidjson::PrettyWriter<rapidjson::StringBuffer> _writer;
+        std::vector<char> _outputBuffer;
+        std::ofstream _outputStream;
+        rapidjson::OStreamWrapper _streamWrapper;
+        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> _writer;
     };
     //--------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "platform.h"
+
+#include <filesystem>
+#include <cstddef>
+
+namespace Storyteller
+{
+    // Read-only view of a whole file mapped into memory
+    class MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const;
+        const std::byte* GetData() const;
+        std::size_t GetSize() const;
+
+    private:
+        const std::byte* _data = nullptr;
+        std::size_t _size = 0;
+#if defined STRTLR_PLATFORM_WINDOWS
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#else
+        int _fileDescriptor = -1;
+#endif
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -14,6 +14,15 @@ namespace Storyteller
 
         const std::string& GetConfigPath() const;
 
+        bool IsHeadless() const;
+        bool IsExplore() const;
+        const std::string& GetChoicesPath() const;
+        // 0 when not given, headless and exploration runs have defaults of their own
+        unsigned int GetPlaythroughsCount() const;
+        uint64_t GetSeed() const;
+        unsigned int GetMaxSteps() const;
+        unsigned int GetThreadsCount() const;
+
     private:
         boost::program_options::command_line_parser CreateCmdParser(char* lpCmdLine) const;
         boost::program_options::command_line_parser CreateCmdParser(int argc, char** argv) const;
@@ -21,6 +30,13 @@ namespace Storyteller
 
     private:
         std::string _configPath;
+        bool _headless;
+        bool _explore;
+        std::string _choicesPath;
+        unsigned int _playthroughsCount;
+        uint64_t _seed;
+        unsigned int _maxSteps;
+        unsigned int _threadsCount;
     };
     //--------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "pointers.h"
+#include "uuid.h"
+#include "game_document.h"
+#include "story_graph.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace Storyteller
+{
+    // Monte Carlo exploration of a game document: plays random games on all cores
+    // and gathers visit statistics, and finds quests that cannot be reached or cannot end the game
+    class StoryExplorer
+    {
+    public:
+        struct Options
+        {
+            uint64_t playthroughs = 1000000;
+            uint64_t seed = 0;
+            unsigned int maxSteps = 10000;
+            unsigned int threads = 0;
+        };
+
+        struct Result
+        {
+            uint64_t playthroughs = 0;
+            uint64_t completed = 0;
+            uint64_t stepsLimitReached = 0;
+            uint64_t stuck = 0;
+            double averagePathLength = 0.0;
+            double seconds = 0.0;
+
+            // indexed by the story graph quest index
+            std::vector<uint64_t> questVisits;
+
+            std::vector<UUID> unreachableQuests;
+            std::vector<UUID> nonTerminatingQuests;
+            std::vector<UUID> unvisitedQuests;
+        };
+
+    public:
+        explicit StoryExplorer(const Ptr<GameDocument> document);
+
+        bool Explore(const Options& options, Result& result) const;
+        Ptr<StoryGraph> GetStoryGraph() const;
+
+    private:
+        void Simulate(const Options& options, Result& result) const;
+        void FindUnreachableQuests(Result& result) const;
+        void FindNonTerminatingQuests(Result& result) const;
+
+    private:
+        const Ptr<GameDocument> _document;
+        const Ptr<StoryGraph> _storyGraph;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
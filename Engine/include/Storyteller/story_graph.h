@@ -0,0 +1,77 @@
+#pragma once
+
+#include "pointers.h"
+#include "uuid.h"
+#include "entities.h"
+#include "game_document.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace Storyteller
+{
+    // Immutable form of the part of a game document reachable from its entry point,
+    // quests and actions refer to each other by dense indices and are validated once on compile
+    class StoryGraph
+    {
+    public:
+        typedef uint32_t Index;
+        static constexpr Index InvalidIndex = Index(-1);
+
+        struct Quest
+        {
+            Index text;
+            Index firstAction;
+            Index actionsCount;
+            bool final;
+        };
+
+        struct Action
+        {
+            Index text;
+            Index target;
+        };
+
+        struct CompileError
+        {
+            UUID uuid;
+            ObjectType requiredType = ObjectType::ErrorObjectType;
+            bool objectMissing = false;
+        };
+
+    public:
+        static Ptr<StoryGraph> Compile(const GameDocument& document, CompileError* error = nullptr);
+
+        const std::string& GetDomainName() const;
+        Index GetGameNameText() const;
+        Index GetEntryQuest() const;
+
+        const Quest& GetQuest(Index index) const;
+        const Action& GetAction(Index index) const;
+        Index GetQuestAction(const Quest& quest, Index number) const;
+        UUID GetQuestUuid(Index index) const;
+        UUID GetActionUuid(Index index) const;
+
+        size_t GetQuestsCount() const;
+        size_t GetActionsCount() const;
+
+        const std::vector<std::string>& GetTexts() const;
+
+    private:
+        StoryGraph();
+
+    private:
+        std::string _domainName;
+        Index _gameNameText;
+        Index _entryQuest;
+
+        std::vector<Quest> _quests;
+        std::vector<Action> _actions;
+        std::vector<Index> _questActions;
+        std::vector<UUID> _questUuids;
+        std::vector<UUID> _actionUuids;
+        std::vector<std::string> _texts;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -6,14 +6,21 @@
 #include "Storyteller/entities.h"
 #include "Storyteller/event.h"
 #include "Storyteller/filesystem.h"
+#include "Storyteller/memory_mapped_file.h"
 #include "Storyteller/game_document.h"
 #include "Storyteller/game_document_manager.h"
+#include "Storyteller/game_document_journal.h"
+#include "Storyteller/game_document_analyzer.h"
+#include "Storyteller/game_document_search_index.h"
 #include "Storyteller/game_document_serializer.h"
 #include "Storyteller/game_document_sort_filter_proxy_view.h"
+#include "Storyteller/story_graph.h"
+#include "Storyteller/story_explorer.h"
 #include "Storyteller/image.h"
 #include "Storyteller/key_codes.h"
 #include "Storyteller/key_event.h"
 #include "Storyteller/i18n_manager.h"
+#include "Storyteller/i18n_catalog.h"
 #include "Storyteller/log.h"
 #include "Storyteller/mouse_codes.h"
 #include "Storyteller/mouse_event.h"
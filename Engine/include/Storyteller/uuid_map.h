@@ -0,0 +1,210 @@
+#pragma once
+
+#include "uuid.h"
+
+#include <vector>
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace Storyteller
+{
+    // Open addressing hash map keyed by UUID: keys and values are kept inline in one flat array
+    // and probed linearly, so a lookup usually reads a single cache line instead of a list node
+    template<typename T>
+    class UuidMap
+    {
+    public:
+        T* Find(const UUID& uuid)
+        {
+            return const_cast<T*>(std::as_const(*this).Find(uuid));
+        }
+
+        const T* Find(const UUID& uuid) const
+        {
+            const auto key = uint64_t(uuid);
+            if (key == EmptyKey)
+            {
+                return _emptyKeyValue ? &*_emptyKeyValue : nullptr;
+            }
+
+            if (_slots.empty())
+            {
+                return nullptr;
+            }
+
+            for (auto i = GetHome(key);; i = (i + 1) & _mask)
+            {
+                const auto& slot = _slots[i];
+                if (slot.key == key)
+                {
+                    return &slot.value;
+                }
+
+                if (slot.key == EmptyKey)
+                {
+                    return nullptr;
+                }
+            }
+        }
+
+        bool Contains(const UUID& uuid) const
+        {
+            return Find(uuid) != nullptr;
+        }
+
+        // false when the UUID is already in the map, the stored value is kept then
+        bool Insert(const UUID& uuid, T value)
+        {
+            const auto key = uint64_t(uuid);
+            if (key == EmptyKey)
+            {
+                if (_emptyKeyValue)
+                {
+                    return false;
+                }
+
+                _emptyKeyValue = std::move(value);
+                _size++;
+                return true;
+            }
+
+            // probe sequences stay short while at least a quarter of the slots is free
+            if ((_size + 1) * 4 > _slots.size() * 3)
+            {
+                Rehash(std::max<std::size_t>(MinCapacity, _slots.size() * 2));
+            }
+
+            for (auto i = GetHome(key);; i = (i + 1) & _mask)
+            {
+                auto& slot = _slots[i];
+                if (slot.key == key)
+                {
+                    return false;
+                }
+
+                if (slot.key == EmptyKey)
+                {
+                    slot.key = key;
+                    slot.value = std::move(value);
+                    _size++;
+                    return true;
+                }
+            }
+        }
+
+        bool Erase(const UUID& uuid)
+        {
+            const auto key = uint64_t(uuid);
+            if (key == EmptyKey)
+            {
+                if (!_emptyKeyValue)
+                {
+                    return false;
+                }
+
+                _emptyKeyValue.reset();
+                _size--;
+                return true;
+            }
+
+            if (_slots.empty())
+            {
+                return false;
+            }
+
+            auto hole = GetHome(key);
+            while (_slots[hole].key != key)
+            {
+                if (_slots[hole].key == EmptyKey)
+                {
+                    return false;
+                }
+
+                hole = (hole + 1) & _mask;
+            }
+
+            // later entries of the probe run move back into the hole, so erasing leaves no tombstones;
+            // an entry may move only when the hole lies between its home slot and its current slot
+            for (auto i = (hole + 1) & _mask; _slots[i].key != EmptyKey; i = (i + 1) & _mask)
+            {
+                const auto home = GetHome(_slots[i].key);
+                if (((i - home) & _mask) >= ((i - hole) & _mask))
+                {
+                    _slots[hole] = std::move(_slots[i]);
+                    hole = i;
+                }
+            }
+
+            _slots[hole].key = EmptyKey;
+            _slots[hole].value = T();
+            _size--;
+            return true;
+        }
+
+        void Reserve(std::size_t count)
+        {
+            const auto capacity = std::bit_ceil(std::max<std::size_t>(MinCapacity, count * 4 / 3 + 1));
+            if (capacity > _slots.size())
+            {
+                Rehash(capacity);
+            }
+        }
+
+        std::size_t Size() const
+        {
+            return _size;
+        }
+
+    private:
+        struct Slot
+        {
+            uint64_t key = EmptyKey;
+            T value = T();
+        };
+
+        // the invalid UUID marks free slots, its value is kept aside
+        static constexpr uint64_t EmptyKey = 0;
+        static constexpr std::size_t MinCapacity = 16;
+
+    private:
+        // multiplicative hashing spreads sequential and strided UUIDs over the whole table
+        std::size_t GetHome(uint64_t key) const
+        {
+            return std::size_t((key * 0x9E3779B97F4A7C15ull) >> _shift);
+        }
+
+        void Rehash(std::size_t capacity)
+        {
+            auto slots = std::exchange(_slots, std::vector<Slot>(capacity));
+            _mask = capacity - 1;
+            _shift = 64 - std::countr_zero(capacity);
+
+            for (auto& slot : slots)
+            {
+                if (slot.key == EmptyKey)
+                {
+                    continue;
+                }
+
+                auto i = GetHome(slot.key);
+                while (_slots[i].key != EmptyKey)
+                {
+                    i = (i + 1) & _mask;
+                }
+
+                _slots[i] = std::move(slot);
+            }
+        }
+
+    private:
+        std::vector<Slot> _slots;
+        std::optional<T> _emptyKeyValue;
+        std::size_t _size = 0;
+        std::size_t _mask = 0;
+        int _shift = 64;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
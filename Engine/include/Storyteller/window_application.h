@@ -13,7 +13,7 @@ namespace Storyteller
     public:
         WindowApplication();
 
-        bool Initialize(const std::string& configPath) override;
+        bool Initialize(const ProgramOptions& programOptions) override;
 
     protected:
         virtual bool OnWindowMoveEvent(WindowMoveEvent& event) { return true; };
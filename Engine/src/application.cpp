@@ -2,6 +2,7 @@
 #include "log.h"
 #include "filesystem.h"
 #include "config.h"
+#include "game_document_analyzer.h"
 
 namespace Storyteller
 {
@@ -12,8 +13,10 @@ namespace Storyteller
     {}
     //--------------------------------------------------------------------------
 
-    bool Application::Initialize(const std::string& configPath)
+    bool Application::Initialize(const ProgramOptions& programOptions)
     {
+        const auto& configPath = programOptions.GetConfigPath();
+
         Filesystem::Initialize();
 
         _config.reset(new Config());
@@ -27,6 +30,11 @@ namespace Storyteller
         _i18nManager->AddLocaleChangedCallback([this]() {
             _i18nManager->Translate(STRTLR_TR_DOMAIN_ENGINE, "Quest object");
             _i18nManager->Translate(STRTLR_TR_DOMAIN_ENGINE, "Action object");
+
+            for (auto type = int(DiagnosticType::EmptyNameType); type <= int(DiagnosticType::NonTerminatingQuestType); type++)
+            {
+                _i18nManager->Translate(STRTLR_TR_DOMAIN_ENGINE, DiagnosticTypeToString(DiagnosticType(type)));
+            }
         });
 
         _settings.reset(new Settings(GetApplicationName()));
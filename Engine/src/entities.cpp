@@ -2,6 +2,8 @@
 #include "log.h"
 #include "i18n_manager.h"
 
+#include <algorithm>
+
 namespace Storyteller
 {
     std::string ObjectTypeToString(ObjectType type)
@@ -41,7 +43,7 @@ namespace Storyteller
     //--------------------------------------------------------------------------
 
 
-    BasicObject::BasicObject(const UUID& uuid, const std::function<void()>& changeCallback)
+    BasicObject::BasicObject(const UUID& uuid, const ChangeCallback& changeCallback)
         : _uuid(uuid)
         , _name("")
         , _changeCallback(changeCallback)
@@ -66,24 +68,30 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_DEBUG("BasicObject: ({}) set name '{}'", _uuid, name);
 
-            _name = name;
-            if (_changeCallback)
-            {
-                _changeCallback();
-            }
+            const auto previousName = std::exchange(_name, name);
+            NotifyChange(ObjectChangeType::NameChangeType, previousName);
         }
     }
     //--------------------------------------------------------------------------
 
-    void BasicObject::SetChangeCallback(const std::function<void()>& changeCallback)
+    void BasicObject::SetChangeCallback(const ChangeCallback& changeCallback)
     {
         _changeCallback = changeCallback;
     }
     //--------------------------------------------------------------------------
+
+    void BasicObject::NotifyChange(ObjectChangeType type, std::string_view previousString, const UUID& relatedUuid)
+    {
+        if (_changeCallback)
+        {
+            _changeCallback({ type, this, previousString, relatedUuid });
+        }
+    }
+    //--------------------------------------------------------------------------
     //--------------------------------------------------------------------------
 
 
-    TextObject::TextObject(const UUID& uuid, const std::function<void()>& changeCallback)
+    TextObject::TextObject(const UUID& uuid, const ChangeCallback& changeCallback)
         : BasicObject(uuid, changeCallback)
         , _text("")
     {
@@ -103,11 +111,8 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_DEBUG("TextObject: ({}) set text '{}'", _uuid, text);
 
-            _text = text;
-            if (_changeCallback)
-            {
-                _changeCallback();
-            }
+            const auto previousText = std::exchange(_text, text);
+            NotifyChange(ObjectChangeType::TextChangeType, previousText);
         }
     }
     //--------------------------------------------------------------------------
@@ -120,7 +125,7 @@ namespace Storyteller
     //--------------------------------------------------------------------------
 
 
-    QuestObject::QuestObject(const UUID& uuid, const std::function<void()>& changeCallback)
+    QuestObject::QuestObject(const UUID& uuid, const ChangeCallback& changeCallback)
         : TextObject(uuid, changeCallback)
         , _final(false)
     {
@@ -168,10 +173,7 @@ namespace Storyteller
         }
 
         _actions.push_back(actionUuid);
-        if (_changeCallback)
-        {
-            _changeCallback();
-        }
+        NotifyChange(ObjectChangeType::ActionAddChangeType, {}, actionUuid);
 
         return true;
     }
@@ -189,12 +191,25 @@ namespace Storyteller
         }
 
         _actions.erase(it);
-        if (_changeCallback)
+        NotifyChange(ObjectChangeType::ActionRemoveChangeType, {}, actionUuid);
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    std::size_t QuestObject::RemoveActions(const std::unordered_set<UUID>& actionUuids)
+    {
+        const auto it = std::stable_partition(_actions.begin(), _actions.end(), [&](const UUID& actionUuid) { return !actionUuids.contains(actionUuid); });
+        const std::vector<UUID> removedActions(it, _actions.end());
+        _actions.erase(it, _actions.end());
+
+        for (const auto& actionUuid : removedActions)
         {
-            _changeCallback();
+            STRTLR_CORE_LOG_DEBUG("QuestObject: ({}) remove action '{}'", _uuid, actionUuid);
+            NotifyChange(ObjectChangeType::ActionRemoveChangeType, {}, actionUuid);
         }
 
-        return true;
+        return removedActions.size();
     }
     //--------------------------------------------------------------------------
 
@@ -208,10 +223,7 @@ namespace Storyteller
 
         std::swap(_actions[actionIndex], _actions[actionIndex - 1]);
 
-        if (_changeCallback)
-        {
-            _changeCallback();
-        }
+        NotifyChange(ObjectChangeType::ActionMoveChangeType, {}, actionUuid);
 
         return true;
     }
@@ -227,10 +239,7 @@ namespace Storyteller
 
         std::swap(_actions[actionIndex], _actions[actionIndex + 1]);
 
-        if (_changeCallback)
-        {
-            _changeCallback();
-        }
+        NotifyChange(ObjectChangeType::ActionMoveChangeType, {}, actionUuid);
 
         return true;
     }
@@ -255,10 +264,7 @@ namespace Storyteller
             STRTLR_CORE_LOG_DEBUG("QuestObject: ({}) set final '{}'", _uuid, isFinal);
 
             _final = isFinal;
-            if (_changeCallback)
-            {
-                _changeCallback();
-            }
+            NotifyChange(ObjectChangeType::FinalChangeType);
         }
     }
     //--------------------------------------------------------------------------
@@ -271,7 +277,7 @@ namespace Storyteller
     //--------------------------------------------------------------------------
 
 
-    ActionObject::ActionObject(const UUID& uuid, const std::function<void()>& changeCallback)
+    ActionObject::ActionObject(const UUID& uuid, const ChangeCallback& changeCallback)
         : TextObject(uuid, changeCallback)
         , _targetUuid(UUID::InvalidUuid)
     {
@@ -308,11 +314,8 @@ namespace Storyteller
         if (_targetUuid != targetUuid)
         {
             STRTLR_CORE_LOG_DEBUG("ActionObject: ({}) set target '{}'", _uuid, targetUuid);
-            _targetUuid = targetUuid;
-            if (_changeCallback)
-            {
-                _changeCallback();
-            }
+            const auto previousTargetUuid = std::exchange(_targetUuid, targetUuid);
+            NotifyChange(ObjectChangeType::TargetChangeType, {}, previousTargetUuid);
         }
     }
     //--------------------------------------------------------------------------
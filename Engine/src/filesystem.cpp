@@ -1,4 +1,11 @@
 #include "filesystem.h"
+#include "platform.h"
+
+#if !defined STRTLR_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
 
 namespace Storyteller
 {
@@ -47,6 +54,75 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
+    bool Filesystem::DurableRename(const std::filesystem::path& source, const std::filesystem::path& target, std::error_code& error)
+    {
+        error.clear();
+
+#if defined STRTLR_PLATFORM_WINDOWS
+        const auto fileHandle = CreateFileW(source.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            error = std::error_code(int(GetLastError()), std::system_category());
+            return false;
+        }
+
+        const auto flushed = FlushFileBuffers(fileHandle);
+        if (!flushed)
+        {
+            error = std::error_code(int(GetLastError()), std::system_category());
+        }
+
+        CloseHandle(fileHandle);
+        if (!flushed)
+        {
+            return false;
+        }
+
+        // write-through returns only after the new directory entry is on disk
+        if (!MoveFileExW(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        {
+            error = std::error_code(int(GetLastError()), std::system_category());
+            return false;
+        }
+#else
+        const auto syncPath = [&error](const std::filesystem::path& path, int flags) {
+            const auto fileDescriptor = open(path.c_str(), flags);
+            if (fileDescriptor < 0 || fsync(fileDescriptor) != 0)
+            {
+                error = std::error_code(errno, std::generic_category());
+            }
+
+            if (fileDescriptor >= 0)
+            {
+                close(fileDescriptor);
+            }
+
+            return !error;
+        };
+
+        if (!syncPath(source, O_RDONLY))
+        {
+            return false;
+        }
+
+        std::filesystem::rename(source, target, error);
+        if (error)
+        {
+            return false;
+        }
+
+        // the rename itself is durable only once the directory is flushed
+        const auto directory = target.has_parent_path() ? target.parent_path() : std::filesystem::path(".");
+        if (!syncPath(directory, O_RDONLY | O_DIRECTORY))
+        {
+            return false;
+        }
+#endif
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
     std::string Filesystem::ToU8String(const std::filesystem::path& path)
     {
         return path.generic_u8string();
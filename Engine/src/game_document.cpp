@@ -1,7 +1,12 @@
 #include "game_document.h"
+#include "game_document_analyzer.h"
+#include "game_document_search_index.h"
 #include "log.h"
 #include "filesystem.h"
 #include "string_utils.h"
+#include "function_utils.h"
+
+#include <algorithm>
 
 namespace Storyteller
 {
@@ -10,12 +15,62 @@ namespace Storyteller
         , _domainName("Untitled")
         , _path(path)
         , _dirty(false)
+        , _revision(0)
+        , _propertiesChanged(false)
+        , _indicesBuilt(true)
+        , _removingObjects(false)
         , _entryPointUuid(UUID::InvalidUuid)
+        , _consistencyCache(CreateUPtr<GameDocumentConsistencyCache>(*this))
+        , _searchIndex(CreateUPtr<GameDocumentSearchIndex>(*this))
     {
         STRTLR_CORE_LOG_INFO("GameDocument: create '{}'", Filesystem::ToU8String(path));
     }
     //--------------------------------------------------------------------------
 
+    GameDocument::~GameDocument() = default;
+    //--------------------------------------------------------------------------
+
+    Ptr<GameDocument> GameDocument::Clone() const
+    {
+        auto clone = CreatePtr<GameDocument>(_path);
+        clone->_gameName = _gameName;
+        clone->_domainName = _domainName;
+        clone->_dirty = _dirty;
+        clone->_revision = _revision;
+        clone->_entryPointUuid = _entryPointUuid;
+        clone->_nextNameIndices = _nextNameIndices;
+
+        clone->_objects.reserve(_objects.size());
+        clone->_questObjects.reserve(_questObjects.size());
+        clone->_actionObjects.reserve(_actionObjects.size());
+        clone->_textObjects.reserve(_textObjects.size());
+
+        // objects are copied as is, without the per-object checks and logging of AddObject
+        std::vector<Ptr<BasicObject>> objects;
+        objects.reserve(_objects.size());
+        for (const auto& object : _objects)
+        {
+            switch (object->GetObjectType())
+            {
+            case ObjectType::QuestObjectType:
+                objects.push_back(CreatePtr<QuestObject>(*static_cast<const QuestObject*>(object.get())));
+                break;
+
+            case ObjectType::ActionObjectType:
+                objects.push_back(CreatePtr<ActionObject>(*static_cast<const ActionObject*>(object.get())));
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        clone->InsertObjects(objects);
+
+        return clone;
+    }
+    //--------------------------------------------------------------------------
+
     std::string GameDocument::GetGameName() const
     {
         return _gameName;
@@ -28,6 +83,7 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("GameDocument: set name '{}'", gameName);
             _gameName = gameName;
+            _propertiesChanged = true;
             SetDirty(true);
         }
     }
@@ -45,6 +101,7 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("GameDocument: set domain name '{}'", domainName);
             _domainName = domainName;
+            _propertiesChanged = true;
             SetDirty(true);
         }
     }
@@ -82,6 +139,35 @@ namespace Storyteller
     void GameDocument::SetDirty(bool dirty)
     {
         _dirty = dirty;
+        if (dirty)
+        {
+            ++_revision;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    uint64_t GameDocument::GetRevision() const
+    {
+        return _revision;
+    }
+    //--------------------------------------------------------------------------
+
+    const std::unordered_set<UUID>& GameDocument::GetChangedObjects() const
+    {
+        return _changedObjects;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocument::ArePropertiesChanged() const
+    {
+        return _propertiesChanged;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::ResetChanges()
+    {
+        _changedObjects.clear();
+        _propertiesChanged = false;
     }
     //--------------------------------------------------------------------------
 
@@ -89,57 +175,33 @@ namespace Storyteller
     {
         STRTLR_CORE_LOG_INFO("GameDocument: add object ({}) of type '{}'", uuid, ObjectTypeToString(type));
 
-        if (type == ObjectType::ErrorObjectType || std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> obj) { return obj->GetUuid() == uuid; }) != _objects.cend())
+        if (type == ObjectType::ErrorObjectType || _objectsIndex.Contains(uuid))
         {
             STRTLR_CORE_LOG_WARN("GameDocument: type is invalid or ({}) is already exist", uuid);
             return false;
         }
 
+        Ptr<BasicObject> newObject;
         switch (type)
         {
         case ObjectType::QuestObjectType:
-        {
-            const auto questObjects = GetObjects<QuestObject>();
-            auto nameIndex = 1;
-            auto name = Utils::Concatenate(ObjectTypeToString(ObjectType::QuestObjectType), nameIndex);
-            while (std::find_if(questObjects.cbegin(), questObjects.cend(), [&](const Ptr<QuestObject> obj) { return obj->GetName() == name; }) != questObjects.cend())
-            {
-                ++nameIndex;
-                name = Utils::Concatenate(ObjectTypeToString(ObjectType::QuestObjectType), nameIndex);
-            }
-
-            auto newObject = CreatePtr<QuestObject>(uuid, [this]() { SetDirty(true); });
-            newObject->SetName(name);
-
-            _objects.push_back(newObject);
-            SetDirty(true);
-            return true;
-        }
+            newObject = CreatePtr<QuestObject>(uuid);
+            break;
 
         case ObjectType::ActionObjectType:
-        {
-            const auto actionObjects = GetObjects<ActionObject>();
-            auto nameIndex = 1;
-            auto name = Utils::Concatenate(ObjectTypeToString(ObjectType::ActionObjectType), nameIndex);
-            while (std::find_if(actionObjects.cbegin(), actionObjects.cend(), [&](const Ptr<ActionObject> obj) { return obj->GetName() == name; }) != actionObjects.cend())
-            {
-                ++nameIndex;
-                name = Utils::Concatenate(ObjectTypeToString(ObjectType::ActionObjectType), nameIndex);
-            }
-
-            auto newObject = CreatePtr<ActionObject>(uuid, [this]() { SetDirty(true); });
-            newObject->SetName(name);
-
-            _objects.push_back(newObject);
-            SetDirty(true);
-            return true;
-        }
+            newObject = CreatePtr<ActionObject>(uuid);
+            break;
 
         default:
-            break;
+            return false;
         }
 
-        return false;
+        newObject->SetName(GenerateObjectName(type));
+
+        InsertObject(newObject);
+        _changedObjects.insert(uuid);
+        SetDirty(true);
+        return true;
     }
     //--------------------------------------------------------------------------
 
@@ -147,42 +209,191 @@ namespace Storyteller
     {
         STRTLR_CORE_LOG_INFO("GameDocument: add object ({}) of type '{}'", object->GetUuid(), ObjectTypeToString(object->GetObjectType()));
 
-        if (std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> obj) { return obj->GetUuid() == object->GetUuid(); }) != _objects.cend())
+        if (object->GetObjectType() == ObjectType::ErrorObjectType || _objectsIndex.Contains(object->GetUuid()))
         {
             STRTLR_CORE_LOG_WARN("GameDocument: type is invalid or ({}) is already exist", object->GetUuid());
             return false;
         }
 
-        object->SetChangeCallback([this]() { SetDirty(true); });
-        _objects.push_back(object);
+        InsertObject(object);
+        _changedObjects.insert(object->GetUuid());
         SetDirty(true);
         return true;
     }
     //--------------------------------------------------------------------------
 
+    std::size_t GameDocument::AddObjects(const std::vector<Ptr<BasicObject>>& objects)
+    {
+        std::vector<Ptr<BasicObject>> newObjects;
+        newObjects.reserve(objects.size());
+
+        std::unordered_set<UUID> newUuids;
+        newUuids.reserve(objects.size());
+        for (const auto& object : objects)
+        {
+            if (object->GetObjectType() != ObjectType::ErrorObjectType && !_objectsIndex.Contains(object->GetUuid()) && newUuids.insert(object->GetUuid()).second)
+            {
+                newObjects.push_back(object);
+            }
+        }
+
+        STRTLR_CORE_LOG_INFO("GameDocument: add {} objects", newObjects.size());
+        if (newObjects.size() != objects.size())
+        {
+            STRTLR_CORE_LOG_WARN("GameDocument: {} objects have invalid type or already exist", objects.size() - newObjects.size());
+        }
+
+        if (newObjects.empty())
+        {
+            return 0;
+        }
+
+        InsertObjects(newObjects);
+        _changedObjects.merge(newUuids);
+        SetDirty(true);
+        return newObjects.size();
+    }
+    //--------------------------------------------------------------------------
+
     bool GameDocument::RemoveObject(const UUID& uuid)
     {
         STRTLR_CORE_LOG_INFO("GameDocument: removing object ({})", uuid);
 
-        const auto it = std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> obj) { return obj->GetUuid() == uuid; });
-        if (it == _objects.cend())
+        const auto object = _objectsIndex.Find(uuid);
+        if (!object)
         {
             STRTLR_CORE_LOG_WARN("GameDocument: object ({}) is not found to remove", uuid);
             return false;
         }
 
-        _objects.erase(it);
+        UnindexObjectReferences(**object);
+        EraseObjects({ uuid });
+
+        _consistencyCache->InvalidateObject(uuid, true);
+        _consistencyCache->InvalidateReferrers(uuid);
+        _searchIndex->InvalidateObject(uuid);
+        _changedObjects.insert(uuid);
         SetDirty(true);
         return true;
     }
     //--------------------------------------------------------------------------
 
+    std::size_t GameDocument::RemoveObjects(const std::vector<UUID>& uuids)
+    {
+        STRTLR_CORE_LOG_INFO("GameDocument: removing {} objects with references", uuids.size());
+
+        std::unordered_set<UUID> removedUuids;
+        removedUuids.reserve(uuids.size());
+        for (const auto& uuid : uuids)
+        {
+            if (_objectsIndex.Contains(uuid))
+            {
+                removedUuids.insert(uuid);
+            }
+            else
+            {
+                STRTLR_CORE_LOG_WARN("GameDocument: object ({}) is not found to remove", uuid);
+            }
+        }
+
+        if (removedUuids.empty())
+        {
+            return 0;
+        }
+
+        // referrers are fixed up and reindexed here in one pass, so their own notifications are ignored
+        BuildIndices();
+        _removingObjects = true;
+
+        std::unordered_set<UUID> referrerUuids;
+        std::unordered_set<UUID> questUuids;
+        std::unordered_set<UUID> staleTargetUuids;
+        std::unordered_set<UUID> staleActionUuids;
+        for (const auto& uuid : removedUuids)
+        {
+            const auto [targetingBegin, targetingEnd] = _targetingActions.equal_range(uuid);
+            for (auto it = targetingBegin; it != targetingEnd; ++it)
+            {
+                if (!removedUuids.contains(it->second))
+                {
+                    static_cast<ActionObject*>(_objectsIndex.Find(it->second)->get())->SetTargetUuid(UUID::InvalidUuid);
+                    referrerUuids.insert(it->second);
+                }
+            }
+
+            const auto [containingBegin, containingEnd] = _containingQuests.equal_range(uuid);
+            for (auto it = containingBegin; it != containingEnd; ++it)
+            {
+                if (!removedUuids.contains(it->second))
+                {
+                    questUuids.insert(it->second);
+                }
+            }
+
+            _targetingActions.erase(uuid);
+            _containingQuests.erase(uuid);
+
+            // references of the removed objects themselves
+            const auto& object = *_objectsIndex.Find(uuid);
+            switch (object->GetObjectType())
+            {
+            case ObjectType::QuestObjectType:
+            {
+                const auto& actions = static_cast<const QuestObject*>(object.get())->GetActions();
+                staleActionUuids.insert(actions.cbegin(), actions.cend());
+                break;
+            }
+
+            case ObjectType::ActionObjectType:
+                staleTargetUuids.insert(static_cast<const ActionObject*>(object.get())->GetTargetUuid());
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        for (const auto& questUuid : questUuids)
+        {
+            static_cast<QuestObject*>(_objectsIndex.Find(questUuid)->get())->RemoveActions(removedUuids);
+            referrerUuids.insert(questUuid);
+        }
+
+        UnindexReferences(_targetingActions, staleTargetUuids, removedUuids);
+        UnindexReferences(_containingQuests, staleActionUuids, removedUuids);
+
+        EraseObjects(removedUuids);
+        for (const auto& uuid : removedUuids)
+        {
+            _consistencyCache->InvalidateObject(uuid, true);
+            _searchIndex->InvalidateObject(uuid);
+            _changedObjects.insert(uuid);
+        }
+
+        _removingObjects = false;
+
+        for (const auto& uuid : referrerUuids)
+        {
+            _consistencyCache->InvalidateObject(uuid, true);
+            _changedObjects.insert(uuid);
+        }
+
+        if (removedUuids.contains(_entryPointUuid))
+        {
+            SetEntryPoint(UUID::InvalidUuid);
+        }
+
+        SetDirty(true);
+        return removedUuids.size();
+    }
+    //--------------------------------------------------------------------------
+
     Ptr<BasicObject> GameDocument::GetObject(const UUID& uuid) const
     {
-        const auto it = std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> obj) { return obj->GetUuid() == uuid; });
-        if (it != _objects.cend())
+        const auto object = _objectsIndex.Find(uuid);
+        if (object)
         {
-            return *it;
+            return *object;
         }
 
         return nullptr;
@@ -191,10 +402,11 @@ namespace Storyteller
 
     Ptr<BasicObject> GameDocument::GetObject(const std::string& name) const
     {
-        const auto it = std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> obj) { return obj->GetName() == name; });
-        if (it != _objects.cend())
+        BuildIndices();
+        const auto it = _namesIndex.find(name);
+        if (it != _namesIndex.cend())
         {
-            return *it;
+            return GetObject(it->second);
         }
 
         return nullptr;
@@ -209,14 +421,47 @@ namespace Storyteller
 
     std::vector<Ptr<BasicObject>> GameDocument::GetObjects(ObjectType type) const
     {
-        std::vector<Ptr<BasicObject>> result;
-        std::copy_if(_objects.cbegin(), _objects.cend(), std::back_inserter(result), [type](const Ptr<BasicObject>& object) 
-            {
-                return object->GetObjectType() == type;
-            }
-        );
+        switch (type)
+        {
+        case ObjectType::QuestObjectType:
+            return std::vector<Ptr<BasicObject>>(_questObjects.cbegin(), _questObjects.cend());
+
+        case ObjectType::ActionObjectType:
+            return std::vector<Ptr<BasicObject>>(_actionObjects.cbegin(), _actionObjects.cend());
+
+        default:
+            return {};
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<UUID> GameDocument::GetActionsTargeting(const UUID& uuid) const
+    {
+        BuildIndices();
+
+        std::vector<UUID> actions;
+        const auto [begin, end] = _targetingActions.equal_range(uuid);
+        for (auto it = begin; it != end; ++it)
+        {
+            actions.push_back(it->second);
+        }
+
+        return actions;
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<UUID> GameDocument::GetQuestsContaining(const UUID& actionUuid) const
+    {
+        BuildIndices();
+
+        std::vector<UUID> quests;
+        const auto [begin, end] = _containingQuests.equal_range(actionUuid);
+        for (auto it = begin; it != end; ++it)
+        {
+            quests.push_back(it->second);
+        }
 
-        return result;
+        return quests;
     }
     //--------------------------------------------------------------------------
 
@@ -226,6 +471,8 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("GameDocument: set entry point ({})", uuid);
             _entryPointUuid = uuid;
+            _consistencyCache->InvalidateGraph();
+            _propertiesChanged = true;
             SetDirty(true);
         }
     }
@@ -239,7 +486,8 @@ namespace Storyteller
 
     bool GameDocument::SetObjectName(const UUID& uuid, const std::string& name) const
     {
-        if (std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> ptr) { return !ptr->GetName().empty() && ptr->GetName() == name; }) != _objects.cend())
+        BuildIndices();
+        if (!name.empty() && _namesIndex.contains(name))
         {
             STRTLR_CORE_LOG_WARN("GameDocument: object name '{}' already exists", name);
             return false;
@@ -259,8 +507,368 @@ namespace Storyteller
 
     bool GameDocument::CheckConsistency() const
     {
-        return std::find_if(_objects.cbegin(), _objects.cend(), [&](const Ptr<BasicObject> ptr) { return !ptr->IsConsistent(); }) != _objects.cend()
-            && GetObject(_entryPointUuid) != nullptr;
+        return GetDiagnostics().empty();
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocument::IsObjectConsistent(const UUID& uuid) const
+    {
+        return _consistencyCache->IsConsistent(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Diagnostic> GameDocument::GetObjectDiagnostics(const UUID& uuid) const
+    {
+        return _consistencyCache->GetDiagnostics(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    const std::vector<Diagnostic>& GameDocument::GetDiagnostics() const
+    {
+        return _consistencyCache->GetDiagnostics();
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Ptr<BasicObject>> GameDocument::FindObjects(const std::string& query) const
+    {
+        return _searchIndex->Find(query);
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::InsertObject(const Ptr<BasicObject>& object)
+    {
+        IndexObjectName(object->GetName(), object->GetUuid());
+        IndexObjectReferences(*object);
+        StoreObject(object);
+
+        _consistencyCache->InvalidateObject(object->GetUuid(), true);
+        _consistencyCache->InvalidateReferrers(object->GetUuid());
+        _searchIndex->InvalidateObject(object->GetUuid());
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::InsertObjects(const std::vector<Ptr<BasicObject>>& objects)
+    {
+        // indexing every object one by one costs more than indexing them all on the first lookup, which may never come
+        _indicesBuilt = false;
+        _namesIndex.clear();
+        _targetingActions.clear();
+        _containingQuests.clear();
+
+        _objects.reserve(_objects.size() + objects.size());
+        _objectsIndex.Reserve(_objectsIndex.Size() + objects.size());
+        for (const auto& object : objects)
+        {
+            StoreObject(object);
+        }
+
+        for (const auto& object : objects)
+        {
+            _consistencyCache->InvalidateObject(object->GetUuid(), true);
+            _consistencyCache->InvalidateReferrers(object->GetUuid());
+            _searchIndex->InvalidateObject(object->GetUuid());
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::StoreObject(const Ptr<BasicObject>& object)
+    {
+        object->SetChangeCallback(STRTLR_BIND(GameDocument::OnObjectChange));
+
+        // typed storages are filled once here so that typed enumeration never needs a cast
+        switch (object->GetObjectType())
+        {
+        case ObjectType::QuestObjectType:
+        {
+            const auto questObject = std::static_pointer_cast<QuestObject>(object);
+            _questObjects.push_back(questObject);
+            _textObjects.push_back(questObject);
+            break;
+        }
+
+        case ObjectType::ActionObjectType:
+        {
+            const auto actionObject = std::static_pointer_cast<ActionObject>(object);
+            _actionObjects.push_back(actionObject);
+            _textObjects.push_back(actionObject);
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        _objectsIndex.Insert(object->GetUuid(), object);
+        _objects.push_back(object);
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::EraseObjects(const std::unordered_set<UUID>& uuids)
+    {
+        std::unordered_set<const BasicObject*> erasedObjects;
+        erasedObjects.reserve(uuids.size());
+        for (const auto& uuid : uuids)
+        {
+            const auto object = _objectsIndex.Find(uuid);
+            if (object)
+            {
+                (*object)->SetChangeCallback(nullptr);
+                UnindexObjectName((*object)->GetName(), uuid);
+                erasedObjects.insert(object->get());
+                _objectsIndex.Erase(uuid);
+            }
+        }
+
+        EraseObjects(_objects, erasedObjects);
+        EraseObjects(_questObjects, erasedObjects);
+        EraseObjects(_actionObjects, erasedObjects);
+        EraseObjects(_textObjects, erasedObjects);
+    }
+    //--------------------------------------------------------------------------
+
+    template<typename T>
+    void GameDocument::EraseObjects(std::vector<Ptr<T>>& objects, const std::unordered_set<const BasicObject*>& erasedObjects)
+    {
+        // the index keeps no positions, so the storages stay in insertion order without updating it,
+        // and a single object is found by comparing pointers rather than with a lookup per stored object
+        if (erasedObjects.size() == 1)
+        {
+            const auto erasedObject = *erasedObjects.cbegin();
+            const auto it = std::find_if(objects.begin(), objects.end(), [erasedObject](const Ptr<T>& object) { return object.get() == erasedObject; });
+            if (it != objects.end())
+            {
+                objects.erase(it);
+            }
+        }
+        else if (!erasedObjects.empty())
+        {
+            std::erase_if(objects, [&erasedObjects](const Ptr<T>& object) { return erasedObjects.contains(object.get()); });
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::OnObjectChange(const ObjectChange& change)
+    {
+        if (_removingObjects)
+        {
+            return;
+        }
+
+        const auto uuid = change.object->GetUuid();
+        UpdateIndices(change);
+
+        // names and texts don't change the shape of the quest graph
+        const auto structural = change.type != ObjectChangeType::NameChangeType && change.type != ObjectChangeType::TextChangeType
+            && change.type != ObjectChangeType::ActionMoveChangeType;
+        _consistencyCache->InvalidateObject(uuid, structural);
+
+        if (change.type == ObjectChangeType::NameChangeType || change.type == ObjectChangeType::TextChangeType)
+        {
+            _searchIndex->InvalidateObject(uuid);
+        }
+
+        _changedObjects.insert(uuid);
+        SetDirty(true);
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::UpdateIndices(const ObjectChange& change)
+    {
+        // indices not built yet are built from the objects as they are by then
+        if (!_indicesBuilt)
+        {
+            return;
+        }
+
+        const auto uuid = change.object->GetUuid();
+        switch (change.type)
+        {
+        case ObjectChangeType::NameChangeType:
+            UnindexObjectName(std::string(change.previousString), uuid);
+            IndexObjectName(change.object->GetName(), uuid);
+            break;
+
+        case ObjectChangeType::ActionAddChangeType:
+            _containingQuests.emplace(change.relatedUuid, uuid);
+            break;
+
+        case ObjectChangeType::ActionRemoveChangeType:
+            UnindexReference(_containingQuests, change.relatedUuid, uuid);
+            break;
+
+        case ObjectChangeType::TargetChangeType:
+        {
+            UnindexReference(_targetingActions, change.relatedUuid, uuid);
+
+            const auto targetUuid = static_cast<const ActionObject*>(change.object)->GetTargetUuid();
+            if (targetUuid != UUID::InvalidUuid)
+            {
+                _targetingActions.emplace(targetUuid, uuid);
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::BuildIndices() const
+    {
+        if (_indicesBuilt)
+        {
+            return;
+        }
+
+        _indicesBuilt = true;
+        _namesIndex.reserve(_objects.size());
+        for (const auto& object : _objects)
+        {
+            IndexObjectName(object->GetName(), object->GetUuid());
+            IndexObjectReferences(*object);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::IndexObjectReferences(const BasicObject& object) const
+    {
+        if (!_indicesBuilt)
+        {
+            return;
+        }
+
+        switch (object.GetObjectType())
+        {
+        case ObjectType::QuestObjectType:
+            for (const auto& actionUuid : static_cast<const QuestObject&>(object).GetActions())
+            {
+                _containingQuests.emplace(actionUuid, object.GetUuid());
+            }
+            break;
+
+        case ObjectType::ActionObjectType:
+        {
+            const auto targetUuid = static_cast<const ActionObject&>(object).GetTargetUuid();
+            if (targetUuid != UUID::InvalidUuid)
+            {
+                _targetingActions.emplace(targetUuid, object.GetUuid());
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::UnindexObjectReferences(const BasicObject& object)
+    {
+        if (!_indicesBuilt)
+        {
+            return;
+        }
+
+        switch (object.GetObjectType())
+        {
+        case ObjectType::QuestObjectType:
+            for (const auto& actionUuid : static_cast<const QuestObject&>(object).GetActions())
+            {
+                UnindexReference(_containingQuests, actionUuid, object.GetUuid());
+            }
+            break;
+
+        case ObjectType::ActionObjectType:
+            UnindexReference(_targetingActions, static_cast<const ActionObject&>(object).GetTargetUuid(), object.GetUuid());
+            break;
+
+        default:
+            break;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::UnindexReference(std::unordered_multimap<UUID, UUID>& index, const UUID& uuid, const UUID& referrerUuid)
+    {
+        const auto [begin, end] = index.equal_range(uuid);
+        const auto it = std::find_if(begin, end, [&](const auto& entry) { return entry.second == referrerUuid; });
+        if (it != end)
+        {
+            index.erase(it);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::UnindexReferences(std::unordered_multimap<UUID, UUID>& index, const std::unordered_set<UUID>& uuids, const std::unordered_set<UUID>& referrerUuids)
+    {
+        // equal keys share a bucket, so the range is erased at once and the rest put back rather than erased node by node
+        std::vector<UUID> keptReferrers;
+        for (const auto& uuid : uuids)
+        {
+            const auto [begin, end] = index.equal_range(uuid);
+            keptReferrers.clear();
+            auto rangeSize = std::size_t(0);
+            for (auto it = begin; it != end; ++it, ++rangeSize)
+            {
+                if (!referrerUuids.contains(it->second))
+                {
+                    keptReferrers.push_back(it->second);
+                }
+            }
+
+            if (keptReferrers.size() != rangeSize)
+            {
+                index.erase(begin, end);
+                for (const auto& referrerUuid : keptReferrers)
+                {
+                    index.emplace(uuid, referrerUuid);
+                }
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::IndexObjectName(const std::string& name, const UUID& uuid) const
+    {
+        if (_indicesBuilt && !name.empty())
+        {
+            _namesIndex.emplace(name, uuid);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocument::UnindexObjectName(const std::string& name, const UUID& uuid)
+    {
+        if (!_indicesBuilt)
+        {
+            return;
+        }
+
+        const auto [begin, end] = _namesIndex.equal_range(name);
+        const auto it = std::find_if(begin, end, [&](const auto& entry) { return entry.second == uuid; });
+        if (it != end)
+        {
+            _namesIndex.erase(it);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    std::string GameDocument::GenerateObjectName(ObjectType type)
+    {
+        BuildIndices();
+
+        // the counter only grows, so each index is probed at most once over the document lifetime
+        auto& nameIndex = _nextNameIndices.try_emplace(type, 1).first->second;
+        auto name = Utils::Concatenate(ObjectTypeToString(type), nameIndex);
+        while (_namesIndex.contains(name))
+        {
+            ++nameIndex;
+            name = Utils::Concatenate(ObjectTypeToString(type), nameIndex);
+        }
+
+        ++nameIndex;
+        return name;
     }
     //--------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,490 @@
+#include "game_document_analyzer.h"
+#include "log.h"
+#include "i18n_manager.h"
+
+#include <algorithm>
+
+namespace Storyteller
+{
+    std::string DiagnosticTypeToString(DiagnosticType type)
+    {
+        switch (type)
+        {
+        case DiagnosticType::EmptyNameType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Name is empty");
+            return "Name is empty";
+
+        case DiagnosticType::EmptyTextType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Text is empty");
+            return "Text is empty";
+
+        case DiagnosticType::NoActionsType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Quest is not final and has no actions");
+            return "Quest is not final and has no actions";
+
+        case DiagnosticType::FinalWithActionsType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Quest is final but has actions");
+            return "Quest is final but has actions";
+
+        case DiagnosticType::MissingEntryPointType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Entry point is not found");
+            return "Entry point is not found";
+
+        case DiagnosticType::EntryPointNotQuestType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Entry point is not a quest");
+            return "Entry point is not a quest";
+
+        case DiagnosticType::NoTargetType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Action has no target");
+            return "Action has no target";
+
+        case DiagnosticType::DanglingTargetType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Action target is not found");
+            return "Action target is not found";
+
+        case DiagnosticType::NonQuestTargetType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Action target is not a quest");
+            return "Action target is not a quest";
+
+        case DiagnosticType::DanglingActionType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Quest action is not found");
+            return "Quest action is not found";
+
+        case DiagnosticType::NonActionType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Quest action is not an action");
+            return "Quest action is not an action";
+
+        case DiagnosticType::UnreachableQuestType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "Quest is unreachable from the entry point");
+            return "Quest is unreachable from the entry point";
+
+        case DiagnosticType::NonTerminatingQuestType:
+            I18N::Manager::TranslateDefer(STRTLR_TR_DOMAIN_ENGINE, "No final quest is reachable from the quest");
+            return "No final quest is reachable from the quest";
+
+        default:
+            break;
+        }
+
+        return std::string("Error");
+    }
+    //--------------------------------------------------------------------------
+
+    QuestGraphWalker::QuestGraphWalker(Index questsCount, const std::vector<Edge>& edges)
+        : _forwardOffsets(questsCount + 1, 0)
+        , _forwardEdges(edges.size())
+        , _reverseOffsets(questsCount + 1, 0)
+        , _reverseEdges(edges.size())
+    {
+        for (const auto& [source, target] : edges)
+        {
+            _forwardOffsets[source + 1]++;
+            _reverseOffsets[target + 1]++;
+        }
+
+        for (Index i = 0; i < questsCount; i++)
+        {
+            _forwardOffsets[i + 1] += _forwardOffsets[i];
+            _reverseOffsets[i + 1] += _reverseOffsets[i];
+        }
+
+        std::vector<Index> forwardCursors(_forwardOffsets.begin(), _forwardOffsets.end() - 1);
+        std::vector<Index> reverseCursors(_reverseOffsets.begin(), _reverseOffsets.end() - 1);
+        for (const auto& [source, target] : edges)
+        {
+            _forwardEdges[forwardCursors[source]++] = target;
+            _reverseEdges[reverseCursors[target]++] = source;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<bool> QuestGraphWalker::FindReachable(Index entryQuest) const
+    {
+        std::vector<bool> reachable(_forwardOffsets.size() - 1, false);
+        std::vector<Index> pending = { entryQuest };
+        reachable[entryQuest] = true;
+        Walk(_forwardOffsets, _forwardEdges, reachable, pending);
+
+        return reachable;
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<bool> QuestGraphWalker::FindTerminating(const std::vector<Index>& finalQuests) const
+    {
+        std::vector<bool> terminating(_reverseOffsets.size() - 1, false);
+        std::vector<Index> pending = finalQuests;
+        for (const auto quest : finalQuests)
+        {
+            terminating[quest] = true;
+        }
+
+        Walk(_reverseOffsets, _reverseEdges, terminating, pending);
+
+        return terminating;
+    }
+    //--------------------------------------------------------------------------
+
+    void QuestGraphWalker::Walk(const std::vector<Index>& offsets, const std::vector<Index>& adjacency, std::vector<bool>& visited, std::vector<Index>& pending)
+    {
+        while (!pending.empty())
+        {
+            const auto current = pending.back();
+            pending.pop_back();
+
+            for (auto k = offsets[current]; k < offsets[current + 1]; k++)
+            {
+                if (!visited[adjacency[k]])
+                {
+                    visited[adjacency[k]] = true;
+                    pending.push_back(adjacency[k]);
+                }
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    GameDocumentAnalyzer::GameDocumentAnalyzer(const GameDocument& document)
+        : _document(document)
+    {}
+    //--------------------------------------------------------------------------
+
+
+    std::vector<Diagnostic> GameDocumentAnalyzer::Analyze() const
+    {
+        std::vector<Diagnostic> diagnostics;
+
+        for (const auto& object : _document.GetObjects())
+        {
+            AnalyzeObject(*object, diagnostics);
+        }
+
+        AnalyzeGraph(diagnostics);
+
+        STRTLR_CORE_LOG_INFO("GameDocumentAnalyzer: {} objects analyzed, {} diagnostics", _document.GetObjects().size(), diagnostics.size());
+
+        return diagnostics;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentAnalyzer::AnalyzeObject(const BasicObject& object, std::vector<Diagnostic>& diagnostics) const
+    {
+        if (object.GetName().empty())
+        {
+            diagnostics.push_back({ DiagnosticType::EmptyNameType, object.GetUuid(), UUID::InvalidUuid });
+        }
+
+        switch (object.GetObjectType())
+        {
+        case ObjectType::QuestObjectType:
+            AnalyzeQuest(static_cast<const QuestObject&>(object), diagnostics);
+            break;
+
+        case ObjectType::ActionObjectType:
+            AnalyzeAction(static_cast<const ActionObject&>(object), diagnostics);
+            break;
+
+        default:
+            break;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentAnalyzer::AnalyzeGraph(std::vector<Diagnostic>& diagnostics) const
+    {
+        const auto& questObjects = _document.GetObjects<QuestObject>();
+        const auto questsCount = Index(questObjects.size());
+
+        std::unordered_map<UUID, Index> questIndices;
+        questIndices.reserve(questsCount);
+        for (Index i = 0; i < questsCount; i++)
+        {
+            questIndices.emplace(questObjects[i]->GetUuid(), i);
+        }
+
+        // quest to quest edges through valid actions, final quests end the game so they have none
+        std::vector<QuestGraphWalker::Edge> edges;
+        edges.reserve(_document.GetObjects<ActionObject>().size());
+        for (Index i = 0; i < questsCount; i++)
+        {
+            const auto& questObject = questObjects[i];
+            if (questObject->IsFinal())
+            {
+                continue;
+            }
+
+            for (const auto& actionUuid : questObject->GetActions())
+            {
+                const auto action = _document.GetObject(actionUuid);
+                if (!action || action->GetObjectType() != ObjectType::ActionObjectType)
+                {
+                    continue;
+                }
+
+                const auto target = questIndices.find(static_cast<const ActionObject*>(action.get())->GetTargetUuid());
+                if (target != questIndices.cend())
+                {
+                    edges.emplace_back(i, target->second);
+                }
+            }
+        }
+
+        const QuestGraphWalker walker(questsCount, edges);
+
+        // reachability from the entry point, every quest counts as reachable when there is no valid entry point
+        const auto entryPoint = _document.GetEntryPoint();
+        const auto entry = entryPoint ? questIndices.find(entryPoint->GetUuid()) : questIndices.cend();
+        if (!entryPoint)
+        {
+            diagnostics.push_back({ DiagnosticType::MissingEntryPointType, UUID::InvalidUuid, UUID::InvalidUuid });
+        }
+        else if (entry == questIndices.cend())
+        {
+            diagnostics.push_back({ DiagnosticType::EntryPointNotQuestType, UUID::InvalidUuid, entryPoint->GetUuid() });
+        }
+
+        const auto reachable = entry != questIndices.cend() ? walker.FindReachable(entry->second) : std::vector<bool>(questsCount, true);
+
+        std::vector<Index> finalQuests;
+        for (Index i = 0; i < questsCount; i++)
+        {
+            if (questObjects[i]->IsFinal())
+            {
+                finalQuests.push_back(i);
+            }
+        }
+
+        const auto terminating = walker.FindTerminating(finalQuests);
+
+        for (Index i = 0; i < questsCount; i++)
+        {
+            if (!reachable[i])
+            {
+                diagnostics.push_back({ DiagnosticType::UnreachableQuestType, questObjects[i]->GetUuid(), UUID::InvalidUuid });
+            }
+            else if (!terminating[i])
+            {
+                diagnostics.push_back({ DiagnosticType::NonTerminatingQuestType, questObjects[i]->GetUuid(), UUID::InvalidUuid });
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentAnalyzer::AnalyzeQuest(const QuestObject& questObject, std::vector<Diagnostic>& diagnostics) const
+    {
+        if (questObject.GetText().empty())
+        {
+            diagnostics.push_back({ DiagnosticType::EmptyTextType, questObject.GetUuid(), UUID::InvalidUuid });
+        }
+
+        if (questObject.IsFinal() && !questObject.GetActions().empty())
+        {
+            diagnostics.push_back({ DiagnosticType::FinalWithActionsType, questObject.GetUuid(), UUID::InvalidUuid });
+        }
+        else if (!questObject.IsFinal() && questObject.GetActions().empty())
+        {
+            diagnostics.push_back({ DiagnosticType::NoActionsType, questObject.GetUuid(), UUID::InvalidUuid });
+        }
+
+        for (const auto& actionUuid : questObject.GetActions())
+        {
+            const auto action = _document.GetObject(actionUuid);
+            if (!action)
+            {
+                diagnostics.push_back({ DiagnosticType::DanglingActionType, questObject.GetUuid(), actionUuid });
+            }
+            else if (action->GetObjectType() != ObjectType::ActionObjectType)
+            {
+                diagnostics.push_back({ DiagnosticType::NonActionType, questObject.GetUuid(), actionUuid });
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentAnalyzer::AnalyzeAction(const ActionObject& actionObject, std::vector<Diagnostic>& diagnostics) const
+    {
+        if (actionObject.GetText().empty())
+        {
+            diagnostics.push_back({ DiagnosticType::EmptyTextType, actionObject.GetUuid(), UUID::InvalidUuid });
+        }
+
+        const auto targetUuid = actionObject.GetTargetUuid();
+        if (targetUuid == UUID::InvalidUuid)
+        {
+            diagnostics.push_back({ DiagnosticType::NoTargetType, actionObject.GetUuid(), UUID::InvalidUuid });
+            return;
+        }
+
+        const auto target = _document.GetObject(targetUuid);
+        if (!target)
+        {
+            diagnostics.push_back({ DiagnosticType::DanglingTargetType, actionObject.GetUuid(), targetUuid });
+        }
+        else if (target->GetObjectType() != ObjectType::QuestObjectType)
+        {
+            diagnostics.push_back({ DiagnosticType::NonQuestTargetType, actionObject.GetUuid(), targetUuid });
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    GameDocumentConsistencyCache::GameDocumentConsistencyCache(const GameDocument& document)
+        : _document(document)
+        , _rebuild(true)
+        , _graphDirty(true)
+        , _diagnosticsDirty(true)
+    {}
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::InvalidateObject(const UUID& uuid, bool structural)
+    {
+        // a pending rebuild analyzes everything anyway, so loading does not pay for tracking each object
+        if (!_rebuild)
+        {
+            _dirtyObjects.insert(uuid);
+        }
+
+        _graphDirty |= structural;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::InvalidateReferrers(const UUID& uuid)
+    {
+        if (_rebuild)
+        {
+            return;
+        }
+
+        for (const auto& referrerUuid : _document.GetActionsTargeting(uuid))
+        {
+            _dirtyObjects.insert(referrerUuid);
+        }
+
+        for (const auto& referrerUuid : _document.GetQuestsContaining(uuid))
+        {
+            _dirtyObjects.insert(referrerUuid);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::InvalidateGraph()
+    {
+        _graphDirty = true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentConsistencyCache::IsConsistent(const UUID& uuid)
+    {
+        Update();
+
+        return !_objectDiagnostics.contains(uuid) && !_graphDiagnostics.contains(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Diagnostic> GameDocumentConsistencyCache::GetDiagnostics(const UUID& uuid)
+    {
+        Update();
+
+        std::vector<Diagnostic> diagnostics;
+        for (const auto* source : { &_objectDiagnostics, &_graphDiagnostics })
+        {
+            const auto it = source->find(uuid);
+            if (it != source->cend())
+            {
+                diagnostics.insert(diagnostics.end(), it->second.cbegin(), it->second.cend());
+            }
+        }
+
+        return diagnostics;
+    }
+    //--------------------------------------------------------------------------
+
+    const std::vector<Diagnostic>& GameDocumentConsistencyCache::GetDiagnostics()
+    {
+        Update();
+
+        if (_diagnosticsDirty)
+        {
+            _diagnostics.clear();
+            for (const auto* source : { &_graphDiagnostics, &_objectDiagnostics })
+            {
+                for (const auto& [uuid, diagnostics] : *source)
+                {
+                    _diagnostics.insert(_diagnostics.end(), diagnostics.cbegin(), diagnostics.cend());
+                }
+            }
+
+            _diagnosticsDirty = false;
+        }
+
+        return _diagnostics;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::Update()
+    {
+        if (_rebuild)
+        {
+            STRTLR_CORE_LOG_INFO("GameDocumentConsistencyCache: rebuilding for {} objects", _document.GetObjects().size());
+
+            _objectDiagnostics.clear();
+            for (const auto& object : _document.GetObjects())
+            {
+                AnalyzeObject(object->GetUuid());
+            }
+
+            _rebuild = false;
+            _graphDirty = true;
+            _diagnosticsDirty = true;
+        }
+        else if (!_dirtyObjects.empty())
+        {
+            for (const auto& uuid : _dirtyObjects)
+            {
+                AnalyzeObject(uuid);
+            }
+
+            _dirtyObjects.clear();
+            _diagnosticsDirty = true;
+        }
+
+        // reachability is global, so any structural change costs one linear pass over the quests
+        if (_graphDirty)
+        {
+            AnalyzeGraph();
+            _graphDirty = false;
+            _diagnosticsDirty = true;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::AnalyzeObject(const UUID& uuid)
+    {
+        _objectDiagnostics.erase(uuid);
+
+        const auto object = _document.GetObject(uuid);
+        if (!object)
+        {
+            return;
+        }
+
+        std::vector<Diagnostic> diagnostics;
+        GameDocumentAnalyzer(_document).AnalyzeObject(*object, diagnostics);
+        if (!diagnostics.empty())
+        {
+            _objectDiagnostics.emplace(uuid, std::move(diagnostics));
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentConsistencyCache::AnalyzeGraph()
+    {
+        std::vector<Diagnostic> diagnostics;
+        GameDocumentAnalyzer(_document).AnalyzeGraph(diagnostics);
+
+        _graphDiagnostics.clear();
+        for (const auto& diagnostic : diagnostics)
+        {
+            _graphDiagnostics[diagnostic.uuid].push_back(diagnostic);
+        }
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -0,0 +1,507 @@
+#include "game_document_journal.h"
+#include "game_document_json_keys.h"
+#include "filesystem.h"
+#include "log.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <fstream>
+
+namespace Storyteller
+{
+    namespace
+    {
+        // a record torn by a crash has no line end, the next record must not be glued to it
+        bool EndsWithLineEnd(const std::filesystem::path& path)
+        {
+            std::ifstream inputStream(path, std::ios::binary | std::ios::ate);
+            if (!inputStream.is_open() || inputStream.tellg() <= 0)
+            {
+                return true;
+            }
+
+            inputStream.seekg(-1, std::ios::end);
+            return inputStream.get() == '\n';
+        }
+        //--------------------------------------------------------------------------
+
+        bool ParseRecord(const std::string& line, rapidjson::Document& record)
+        {
+            record.Parse(line.c_str(), line.size());
+            return !record.HasParseError() && record.IsObject();
+        }
+        //--------------------------------------------------------------------------
+
+        // the object keeps its place in the document, only the fields that differ are changed
+        void UpdateObject(BasicObject& object, const BasicObject& replacement)
+        {
+            object.SetName(replacement.GetName());
+            static_cast<TextObject&>(object).SetText(static_cast<const TextObject&>(replacement).GetText());
+
+            switch (object.GetObjectType())
+            {
+            case ObjectType::QuestObjectType:
+            {
+                auto& questObject = static_cast<QuestObject&>(object);
+                const auto& replacementQuestObject = static_cast<const QuestObject&>(replacement);
+                if (questObject.GetActions() != replacementQuestObject.GetActions())
+                {
+                    const auto& actions = questObject.GetActions();
+                    questObject.RemoveActions(std::unordered_set<UUID>(actions.cbegin(), actions.cend()));
+                    for (const auto& actionUuid : replacementQuestObject.GetActions())
+                    {
+                        questObject.AddAction(actionUuid);
+                    }
+                }
+
+                questObject.SetFinal(replacementQuestObject.IsFinal());
+                break;
+            }
+
+            case ObjectType::ActionObjectType:
+                static_cast<ActionObject&>(object).SetTargetUuid(static_cast<const ActionObject&>(replacement).GetTargetUuid());
+                break;
+
+            default:
+                break;
+            }
+        }
+        //--------------------------------------------------------------------------
+    }
+
+    GameDocumentJournal::GameDocumentJournal(const std::filesystem::path& documentPath)
+        : _path(std::filesystem::path(documentPath).concat(".journal"))
+        , _rotatedPath(std::filesystem::path(documentPath).concat(".journal.old"))
+    {}
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::Append(GameDocument& document) const
+    {
+        const auto& changedObjects = document.GetChangedObjects();
+        if (changedObjects.empty() && !document.ArePropertiesChanged())
+        {
+            return true;
+        }
+
+        const auto lineEnded = EndsWithLineEnd(_path);
+        std::ofstream outputStream(_path, std::ios::out | std::ios::app | std::ios::binary);
+        if (!outputStream.is_open() || !outputStream.good())
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to open '{}'", Filesystem::ToU8String(_path));
+            return false;
+        }
+
+        if (!lineEnded)
+        {
+            outputStream << '\n';
+        }
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer;
+        const auto writeString = [&](const char* key, const std::string& value) {
+            writer.Key(key);
+            writer.String(value.c_str(), rapidjson::SizeType(value.size()));
+        };
+
+        if (document.ArePropertiesChanged())
+        {
+            const auto entryPoint = document.GetEntryPoint();
+
+            writer.Reset(buffer);
+            writer.StartObject();
+            writeString(JSON_KEY_GAME_NAME, document.GetGameName());
+            writeString(JSON_KEY_GAME_DOMAIN_NAME, document.GetDomainName());
+            writer.Key(JSON_KEY_ENTRY_POINT_UUID);
+            writer.Uint64(entryPoint ? entryPoint->GetUuid() : UUID::InvalidUuid);
+            writer.EndObject();
+
+            outputStream << buffer.GetString() << '\n';
+        }
+
+        for (const auto& uuid : changedObjects)
+        {
+            buffer.Clear();
+            writer.Reset(buffer);
+            writer.StartObject();
+
+            const auto object = document.GetObject(uuid);
+            if (!object)
+            {
+                writer.Key(JSON_KEY_REMOVED);
+                writer.Uint64(uuid);
+            }
+            else
+            {
+                writer.Key(JSON_KEY_UUID);
+                writer.Uint64(uuid);
+                writeString(JSON_KEY_NAME, object->GetName());
+                writeString(JSON_KEY_OBJECT_TYPE, ObjectTypeToString(object->GetObjectType()));
+
+                if (const auto textObject = dynamic_cast<const TextObject*>(object.get()))
+                {
+                    writeString(JSON_KEY_TEXT, textObject->GetText());
+                }
+
+                if (const auto questObject = dynamic_cast<const QuestObject*>(object.get()))
+                {
+                    writer.Key(JSON_KEY_ACTIONS);
+                    writer.StartArray();
+                    for (const auto& actionUuid : questObject->GetActions())
+                    {
+                        writer.Uint64(actionUuid);
+                    }
+                    writer.EndArray();
+
+                    writer.Key(JSON_KEY_FINAL);
+                    writer.Bool(questObject->IsFinal());
+                }
+                else if (const auto actionObject = dynamic_cast<const ActionObject*>(object.get()))
+                {
+                    writer.Key(JSON_KEY_TARGET);
+                    writer.Uint64(actionObject->GetTargetUuid());
+                }
+            }
+
+            writer.EndObject();
+            outputStream << buffer.GetString() << '\n';
+        }
+
+        outputStream.close();
+        if (outputStream.fail())
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to write '{}'", Filesystem::ToU8String(_path));
+            return false;
+        }
+
+        STRTLR_CORE_LOG_INFO("GameDocumentJournal: appended {} object changes to '{}'", changedObjects.size(), Filesystem::ToU8String(_path));
+        document.ResetChanges();
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::Replay(GameDocument& document) const
+    {
+        // the rotated journal holds older records of an unfinished compaction
+        auto intact = true;
+        const auto ok = ReplayFile(_rotatedPath, document, intact) && ReplayFile(_path, document, intact);
+
+        // replayed records are already journaled, unless some were damaged, then the next append writes them again
+        if (ok && intact)
+        {
+            document.ResetChanges();
+        }
+
+        return ok;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::Rotate() const
+    {
+        if (!Filesystem::PathExists(_path))
+        {
+            return true;
+        }
+
+        if (Filesystem::PathExists(_rotatedPath))
+        {
+            return AppendFile(_path, _rotatedPath);
+        }
+
+        std::error_code error;
+        std::filesystem::rename(_path, _rotatedPath, error);
+        if (error)
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to rotate '{}', {}", Filesystem::ToU8String(_path), error.message());
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::RestoreRotated() const
+    {
+        if (!Filesystem::PathExists(_rotatedPath))
+        {
+            return true;
+        }
+
+        if (Filesystem::PathExists(_path) && !AppendFile(_path, _rotatedPath))
+        {
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(_rotatedPath, _path, error);
+        if (error)
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to restore '{}', {}", Filesystem::ToU8String(_rotatedPath), error.message());
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentJournal::RemoveRotated() const
+    {
+        std::error_code error;
+        std::filesystem::remove(_rotatedPath, error);
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::Relocate(const std::filesystem::path& documentPath) const
+    {
+        const GameDocumentJournal target(documentPath);
+        if (target._path == _path || !Filesystem::PathExists(_path))
+        {
+            return true;
+        }
+
+        target.Discard();
+
+        std::error_code error;
+        std::filesystem::rename(_path, target._path, error);
+        if (error)
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to move '{}', {}", Filesystem::ToU8String(_path), error.message());
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentJournal::Discard() const
+    {
+        std::error_code error;
+        std::filesystem::remove(_path, error);
+        std::filesystem::remove(_rotatedPath, error);
+    }
+    //--------------------------------------------------------------------------
+
+    std::uintmax_t GameDocumentJournal::GetSize() const
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(_path, error);
+
+        return error ? 0 : size;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::ReplayFile(const std::filesystem::path& path, GameDocument& document, bool& intact) const
+    {
+        if (!Filesystem::PathExists(path))
+        {
+            return true;
+        }
+
+        std::ifstream inputStream(path, std::ios::binary);
+        if (!inputStream.is_open() || !inputStream.good())
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to open '{}'", Filesystem::ToU8String(path));
+            return false;
+        }
+
+        STRTLR_CORE_LOG_INFO("GameDocumentJournal: replaying '{}'", Filesystem::ToU8String(path));
+
+        rapidjson::Document record;
+        const auto getUInt64 = [&](const char* key) {
+            const auto member = record.FindMember(key);
+            return member != record.MemberEnd() && member->value.IsUint64() ? member->value.GetUint64() : uint64_t(UUID::InvalidUuid);
+        };
+        const auto getString = [&](const char* key) {
+            const auto member = record.FindMember(key);
+            return member != record.MemberEnd() && member->value.IsString() ? std::string(member->value.GetString(), member->value.GetStringLength()) : std::string();
+        };
+
+        std::string line;
+        auto recordsCount = 0;
+        auto damagedRecordsCount = 0;
+        while (std::getline(inputStream, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+
+            // a record torn by a crash ends its file, but merging a rotated journal can leave it in the middle
+            if (!ParseRecord(line, record))
+            {
+                STRTLR_CORE_LOG_WARN("GameDocumentJournal: '{}' has a damaged record after {} records, skipped", Filesystem::ToU8String(path), recordsCount);
+                ++damagedRecordsCount;
+                continue;
+            }
+
+            if (record.HasMember(JSON_KEY_REMOVED))
+            {
+                const auto uuid = UUID(getUInt64(JSON_KEY_REMOVED));
+                if (document.GetObject(uuid))
+                {
+                    document.RemoveObject(uuid);
+                }
+            }
+            else if (record.HasMember(JSON_KEY_UUID))
+            {
+                const auto uuid = UUID(getUInt64(JSON_KEY_UUID));
+                Ptr<BasicObject> object;
+
+                switch (StringToObjectType(getString(JSON_KEY_OBJECT_TYPE)))
+                {
+                case ObjectType::QuestObjectType:
+                {
+                    auto questObject = CreatePtr<QuestObject>(uuid);
+                    questObject->SetText(getString(JSON_KEY_TEXT));
+                    questObject->SetName(getString(JSON_KEY_NAME));
+
+                    const auto actions = record.FindMember(JSON_KEY_ACTIONS);
+                    if (actions != record.MemberEnd() && actions->value.IsArray())
+                    {
+                        for (const auto& action : actions->value.GetArray())
+                        {
+                            questObject->AddAction(UUID(action.IsUint64() ? action.GetUint64() : uint64_t(UUID::InvalidUuid)));
+                        }
+                    }
+
+                    const auto final = record.FindMember(JSON_KEY_FINAL);
+                    questObject->SetFinal(final != record.MemberEnd() && final->value.IsBool() && final->value.GetBool());
+
+                    object = questObject;
+                    break;
+                }
+
+                case ObjectType::ActionObjectType:
+                {
+                    auto actionObject = CreatePtr<ActionObject>(uuid);
+                    actionObject->SetTargetUuid(UUID(getUInt64(JSON_KEY_TARGET)));
+                    actionObject->SetText(getString(JSON_KEY_TEXT));
+                    actionObject->SetName(getString(JSON_KEY_NAME));
+
+                    object = actionObject;
+                    break;
+                }
+
+                default:
+                    STRTLR_CORE_LOG_WARN("GameDocumentJournal: object ({}) has unknown type, skipped", uuid);
+                    break;
+                }
+
+                if (object)
+                {
+                    const auto existingObject = document.GetObject(uuid);
+                    if (!existingObject)
+                    {
+                        document.AddObject(object);
+                    }
+                    else if (existingObject->GetObjectType() == object->GetObjectType())
+                    {
+                        UpdateObject(*existingObject, *object);
+                    }
+                    else
+                    {
+                        document.RemoveObject(uuid);
+                        document.AddObject(object);
+                    }
+                }
+            }
+            else
+            {
+                document.SetGameName(getString(JSON_KEY_GAME_NAME));
+                document.SetDomainName(getString(JSON_KEY_GAME_DOMAIN_NAME));
+                document.SetEntryPoint(UUID(getUInt64(JSON_KEY_ENTRY_POINT_UUID)));
+            }
+
+            ++recordsCount;
+        }
+
+        STRTLR_CORE_LOG_INFO("GameDocumentJournal: replayed {} records", recordsCount);
+
+        if (damagedRecordsCount > 0)
+        {
+            inputStream.close();
+            intact = false;
+            RemoveDamagedRecords(path);
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentJournal::RemoveDamagedRecords(const std::filesystem::path& path) const
+    {
+        // records appended later would follow the damaged one and be skipped with it on the next replay
+        auto cleanPath = path;
+        cleanPath.concat(".tmp");
+
+        {
+            std::ifstream inputStream(path, std::ios::binary);
+            std::ofstream outputStream(cleanPath, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (!inputStream.is_open() || !outputStream.is_open())
+            {
+                STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to clean '{}'", Filesystem::ToU8String(path));
+                return;
+            }
+
+            rapidjson::Document record;
+            std::string line;
+            while (std::getline(inputStream, line))
+            {
+                if (!line.empty() && ParseRecord(line, record))
+                {
+                    outputStream << line << '\n';
+                }
+            }
+
+            outputStream.close();
+            if (outputStream.fail())
+            {
+                STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to clean '{}'", Filesystem::ToU8String(path));
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(cleanPath, path, error);
+        if (error)
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to clean '{}', {}", Filesystem::ToU8String(path), error.message());
+            std::filesystem::remove(cleanPath, error);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentJournal::AppendFile(const std::filesystem::path& from, const std::filesystem::path& to) const
+    {
+        {
+            const auto lineEnded = EndsWithLineEnd(to);
+            std::ifstream inputStream(from, std::ios::binary);
+            std::ofstream outputStream(to, std::ios::out | std::ios::app | std::ios::binary);
+            if (!inputStream.is_open() || !outputStream.is_open())
+            {
+                STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to merge '{}' into '{}'", Filesystem::ToU8String(from), Filesystem::ToU8String(to));
+                return false;
+            }
+
+            if (!lineEnded)
+            {
+                outputStream << '\n';
+            }
+
+            outputStream << inputStream.rdbuf();
+            if (outputStream.fail())
+            {
+                STRTLR_CORE_LOG_WARN("GameDocumentJournal: failed to merge '{}' into '{}'", Filesystem::ToU8String(from), Filesystem::ToU8String(to));
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::remove(from, error);
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
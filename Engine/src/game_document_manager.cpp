@@ -1,8 +1,8 @@
 #include "game_document_manager.h"
 #include "game_document_serializer.h"
+#include "game_document_journal.h"
 #include "filesystem.h"
 #include "log.h"
-#include "function_utils.h"
 #include "string_utils.h"
 
 #include <fstream>
@@ -11,15 +11,30 @@ namespace Storyteller
 {
     GameDocumentManager::GameDocumentManager(const Ptr<I18N::Manager> i18nManager)
         : _i18nManager(i18nManager)
+        , _savingRevision(0)
+        , _saveState(SaveState::IdleState)
+        , _saveProgress(0.0f)
     {
-        _i18nManager->AddLocaleChangedCallback(STRTLR_BIND(GameDocumentManager::FillDictionary));
-
         NewDocument();
     }
     //--------------------------------------------------------------------------
 
+    GameDocumentManager::~GameDocumentManager()
+    {
+        if (_saveResult.valid())
+        {
+            _saveResult.wait();
+        }
+    }
+    //--------------------------------------------------------------------------
+
     void GameDocumentManager::NewDocument()
     {
+        if (_document)
+        {
+            DiscardJournal();
+        }
+
         _document.reset(new GameDocument());
         _proxy.reset();
     }
@@ -33,14 +48,22 @@ namespace Storyteller
 
         if (success)
         {
+            // recover edits autosaved after the last full save
+            GameDocumentJournal(path).Replay(*newDocument);
+
+            if (_document->GetPath() != path)
+            {
+                DiscardJournal();
+            }
+
             _i18nManager->RemoveMessagesDomain(_document->GetDomainName());
 
             _document.swap(newDocument);
             _proxy.reset();
 
             _i18nManager->AddMessagesPath(Filesystem::ToU8String(_document->GetTranslationsPath()));
+            // texts are translated on demand through I18N::Manager::TranslationLazy
             _i18nManager->AddMessagesDomain(_document->GetDomainName());
-            FillDictionary();
 
             return true;
         }
@@ -58,15 +81,169 @@ namespace Storyteller
 
     bool GameDocumentManager::Save() const
     {
-        GameDocumentSerializer serializer(_document);
-        return serializer.Save();
+        return Save(_document->GetPath());
     }
     //--------------------------------------------------------------------------
 
     bool GameDocumentManager::Save(const std::filesystem::path& path) const
     {
+        const auto previousPath = _document->GetPath();
+
         GameDocumentSerializer serializer(_document);
-        return serializer.Save(path);
+        if (!serializer.Save(path))
+        {
+            return false;
+        }
+
+        // the full file now contains everything the journal had
+        if (!previousPath.empty())
+        {
+            GameDocumentJournal(previousPath).Discard();
+        }
+
+        GameDocumentJournal(path).Discard();
+        _document->ResetChanges();
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentManager::Autosave()
+    {
+        // untitled documents have no place for a journal yet
+        if (_document->GetPath().empty())
+        {
+            return false;
+        }
+
+        const GameDocumentJournal journal(_document->GetPath());
+        if (!journal.Append(*_document))
+        {
+            return false;
+        }
+
+        // compact the journal into the document file once it grows large
+        static constexpr std::uintmax_t JournalCompactionSize = 4 * 1024 * 1024;
+        if (journal.GetSize() > JournalCompactionSize && _saveState != SaveState::SavingState)
+        {
+            return SaveAsync();
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentManager::DiscardJournal() const
+    {
+        if (!_document->GetPath().empty())
+        {
+            GameDocumentJournal(_document->GetPath()).Discard();
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentManager::SaveAsync()
+    {
+        return SaveAsync(_document->GetPath());
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentManager::SaveAsync(const std::filesystem::path& path)
+    {
+        if (_saveState == SaveState::SavingState)
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentManager: previous save is still in progress");
+            return false;
+        }
+
+        STRTLR_CORE_LOG_INFO("GameDocumentManager: saving '{}' in background", Filesystem::ToU8String(path));
+
+        // the worker serializes a private copy, so the document stays editable while saving;
+        // the copy duplicates the objects only, the serializer needs none of the document indices
+        const auto snapshot = _document->Clone();
+        _savingDocument = _document;
+        _savingPath = path;
+        _savingRevision = _document->GetRevision();
+        _saveState = SaveState::SavingState;
+        _saveProgress = 0.0f;
+
+        // changes made from now on go to a fresh journal, older ones are kept aside until the save succeeds
+        _savingJournalPath = _document->GetPath();
+        if (!_savingJournalPath.empty())
+        {
+            const GameDocumentJournal journal(_savingJournalPath);
+            journal.Append(*_document);
+            journal.Rotate();
+        }
+        else
+        {
+            _document->ResetChanges();
+        }
+
+        _saveResult = std::async(std::launch::async, [this, snapshot, path]() {
+            GameDocumentSerializer serializer(snapshot);
+            serializer.SetProgressCallback([this](float progress) { _saveProgress = progress; });
+            return serializer.Save(path);
+            }
+        );
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentManager::UpdateAsyncSave()
+    {
+        if (_saveState != SaveState::SavingState || _saveResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+
+        const auto success = _saveResult.get();
+        _saveState = success ? SaveState::SucceededState : SaveState::FailedState;
+        _saveProgress = 1.0f;
+
+        // the document may have been replaced or edited while the snapshot was written
+        if (success && _savingDocument == _document)
+        {
+            _document->SetPath(_savingPath);
+            if (_document->GetRevision() == _savingRevision)
+            {
+                _document->SetDirty(false);
+            }
+        }
+
+        if (!_savingJournalPath.empty())
+        {
+            const GameDocumentJournal journal(_savingJournalPath);
+            if (_savingDocument != _document)
+            {
+                journal.Discard();
+            }
+            else if (success)
+            {
+                journal.RemoveRotated();
+                journal.Relocate(_savingPath);
+            }
+            else
+            {
+                journal.RestoreRotated();
+            }
+        }
+
+        _savingDocument.reset();
+        _savingJournalPath.clear();
+    }
+    //--------------------------------------------------------------------------
+
+    GameDocumentManager::SaveState GameDocumentManager::GetSaveState() const
+    {
+        return _saveState;
+    }
+    //--------------------------------------------------------------------------
+
+    float GameDocumentManager::GetSaveProgress() const
+    {
+        return _saveProgress;
     }
     //--------------------------------------------------------------------------
 
@@ -134,16 +311,4 @@ namespace Storyteller
         return true;
     }
     //--------------------------------------------------------------------------
-
-    void GameDocumentManager::FillDictionary() const
-    {
-        _i18nManager->Translate(_document->GetDomainName(), _document->GetGameName());
-
-        const auto objects = _document->GetObjects<TextObject>();
-        for (const auto& object : objects)
-        {
-            _i18nManager->Translate(_document->GetDomainName(), object->GetText());
-        }
-    }
-    //--------------------------------------------------------------------------
 }
\ No newline at end of file
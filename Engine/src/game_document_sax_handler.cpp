@@ -0,0 +1,297 @@
+#include "game_document_sax_handler.h"
+#include "game_document_json_keys.h"
+#include "log.h"
+
+namespace Storyteller
+{
+    GameDocumentSaxHandler::GameDocumentSaxHandler(const Ptr<GameDocument> document)
+        : _document(document)
+        , _state(State::StartState)
+        , _key("")
+        , _skipDepth(0)
+        , _pendingObject()
+    {}
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Bool(bool value)
+    {
+        if (_skipDepth == 0 && _state == State::ObjectState && _key == JSON_KEY_FINAL)
+        {
+            _pendingObject.final = value;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Int(int value)
+    {
+        return OnUInt64(value < 0 ? uint64_t(UUID::InvalidUuid) : uint64_t(value));
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Uint(unsigned value)
+    {
+        return OnUInt64(value);
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Int64(int64_t value)
+    {
+        return OnUInt64(value < 0 ? uint64_t(UUID::InvalidUuid) : uint64_t(value));
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Uint64(uint64_t value)
+    {
+        return OnUInt64(value);
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::String(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        if (_skipDepth > 0)
+        {
+            return true;
+        }
+
+        if (_state == State::DocumentState)
+        {
+            if (_key == JSON_KEY_GAME_NAME)
+            {
+                _document->SetGameName(std::string(str, length));
+            }
+            else if (_key == JSON_KEY_GAME_DOMAIN_NAME)
+            {
+                _document->SetDomainName(std::string(str, length));
+            }
+        }
+        else if (_state == State::ObjectState)
+        {
+            if (_key == JSON_KEY_NAME)
+            {
+                _pendingObject.name.assign(str, length);
+            }
+            else if (_key == JSON_KEY_OBJECT_TYPE)
+            {
+                _pendingObject.objectType.assign(str, length);
+            }
+            else if (_key == JSON_KEY_TEXT)
+            {
+                _pendingObject.text.assign(str, length);
+            }
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::Key(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        if (_skipDepth == 0)
+        {
+            _key.assign(str, length);
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::StartObject()
+    {
+        if (_skipDepth > 0)
+        {
+            ++_skipDepth;
+            return true;
+        }
+
+        switch (_state)
+        {
+        case State::StartState:
+            _state = State::DocumentState;
+            return true;
+
+        case State::ObjectsState:
+            _pendingObject = PendingObject();
+            _key.clear();
+            _state = State::ObjectState;
+            return true;
+
+        default:
+            return OnUnexpectedContainer();
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::EndObject(rapidjson::SizeType memberCount)
+    {
+        if (_skipDepth > 0)
+        {
+            --_skipDepth;
+            return true;
+        }
+
+        switch (_state)
+        {
+        case State::DocumentState:
+            _state = State::FinishState;
+            return true;
+
+        case State::ObjectState:
+            _state = State::ObjectsState;
+            return FinishObject();
+
+        default:
+            return false;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::StartArray()
+    {
+        if (_skipDepth > 0)
+        {
+            ++_skipDepth;
+            return true;
+        }
+
+        if (_state == State::DocumentState && _key == JSON_KEY_OBJECTS)
+        {
+            _state = State::ObjectsState;
+            return true;
+        }
+
+        if (_state == State::ObjectState && _key == JSON_KEY_ACTIONS)
+        {
+            _state = State::ActionsState;
+            return true;
+        }
+
+        return OnUnexpectedContainer();
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::EndArray(rapidjson::SizeType elementCount)
+    {
+        if (_skipDepth > 0)
+        {
+            --_skipDepth;
+            return true;
+        }
+
+        switch (_state)
+        {
+        case State::ObjectsState:
+            _state = State::DocumentState;
+            return true;
+
+        case State::ActionsState:
+            _state = State::ObjectState;
+            return true;
+
+        default:
+            return false;
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::IsFinished() const
+    {
+        return _state == State::FinishState;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::OnUInt64(uint64_t value)
+    {
+        if (_skipDepth > 0)
+        {
+            return true;
+        }
+
+        switch (_state)
+        {
+        case State::DocumentState:
+            if (_key == JSON_KEY_ENTRY_POINT_UUID)
+            {
+                _document->SetEntryPoint(UUID(value));
+            }
+            break;
+
+        case State::ObjectState:
+            if (_key == JSON_KEY_UUID)
+            {
+                _pendingObject.uuid = value;
+            }
+            else if (_key == JSON_KEY_TARGET)
+            {
+                _pendingObject.target = value;
+            }
+            break;
+
+        case State::ActionsState:
+            _pendingObject.actions.push_back(UUID(value));
+            break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::OnUnexpectedContainer()
+    {
+        if (_state == State::StartState || _state == State::FinishState)
+        {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSaxHandler: root value is not an object");
+            return false;
+        }
+
+        // unknown groups are skipped entirely
+        _skipDepth = 1;
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSaxHandler::FinishObject()
+    {
+        const auto objectUuid = UUID(_pendingObject.uuid);
+
+        switch (StringToObjectType(_pendingObject.objectType))
+        {
+        case ObjectType::QuestObjectType:
+        {
+            auto questObject = CreatePtr<QuestObject>(objectUuid);
+            questObject->SetText(_pendingObject.text);
+            questObject->SetName(_pendingObject.name);
+
+            for (const auto& actionUuid : _pendingObject.actions)
+            {
+                questObject->AddAction(actionUuid);
+            }
+
+            questObject->SetFinal(_pendingObject.final);
+
+            _document->AddObject(questObject);
+            return true;
+        }
+
+        case ObjectType::ActionObjectType:
+        {
+            auto actionObject = CreatePtr<ActionObject>(objectUuid);
+            actionObject->SetTargetUuid(UUID(_pendingObject.target));
+            actionObject->SetText(_pendingObject.text);
+            actionObject->SetName(_pendingObject.name);
+
+            _document->AddObject(actionObject);
+            return true;
+        }
+
+        default:
+            STRTLR_CORE_LOG_ERROR("GameDocumentSaxHandler: object ({}) has unknown type '{}'", objectUuid, _pendingObject.objectType);
+            return false;
+        }
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
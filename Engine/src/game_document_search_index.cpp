@@ -0,0 +1,287 @@
+#include "game_document_search_index.h"
+#include "game_document.h"
+#include "log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Storyteller
+{
+    GameDocumentSearchIndex::GameDocumentSearchIndex(const GameDocument& document)
+        : _document(document)
+        , _rebuild(true)
+        , _livePostingsCount(0)
+        , _stalePostingsCount(0)
+        , _queryStamp(0)
+    {}
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::InvalidateObject(const UUID& uuid)
+    {
+        // nothing is tracked until the index is built
+        if (!_rebuild)
+        {
+            _dirtyObjects.insert(uuid);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Ptr<BasicObject>> GameDocumentSearchIndex::Find(const std::string& query)
+    {
+        std::vector<Ptr<BasicObject>> result;
+
+        const auto loweredQuery = ToLower(query);
+        if (loweredQuery.empty())
+        {
+            return result;
+        }
+
+        // shorter queries have no trigram to look up
+        if (loweredQuery.size() < 3)
+        {
+            for (const auto& object : _document.GetObjects())
+            {
+                if (MatchesLowered(*object, loweredQuery))
+                {
+                    result.push_back(object);
+                }
+            }
+
+            return result;
+        }
+
+        Update();
+
+        // every match contains all the query trigrams, so any single posting is a complete candidates list
+        _trigrams.clear();
+        CollectTrigrams(loweredQuery, _trigrams);
+        std::sort(_trigrams.begin(), _trigrams.end());
+        _trigrams.erase(std::unique(_trigrams.begin(), _trigrams.end()), _trigrams.end());
+
+        std::vector<const std::vector<Slot>*> postings;
+        postings.reserve(_trigrams.size());
+        for (const auto trigram : _trigrams)
+        {
+            const auto it = _postings.find(trigram);
+            if (it == _postings.cend())
+            {
+                return result;
+            }
+
+            postings.push_back(&it->second);
+        }
+
+        std::sort(postings.begin(), postings.end(), [](const auto* a, const auto* b) { return a->size() < b->size(); });
+
+        if (_queryStamp > std::numeric_limits<uint32_t>::max() - uint32_t(postings.size()) - 2)
+        {
+            for (auto& entry : _entries)
+            {
+                entry.queryStamp = 0;
+            }
+
+            _queryStamp = 0;
+        }
+
+        // the shortest posting is narrowed by the others through stamps, much longer ones cost more than verifying
+        const auto intersectionLimit = postings.front()->size() * 8;
+        auto stamp = ++_queryStamp;
+        for (const auto slot : *postings.front())
+        {
+            _entries[slot].queryStamp = stamp;
+        }
+
+        for (std::size_t i = 1; i < postings.size() && postings[i]->size() <= intersectionLimit; i++)
+        {
+            const auto nextStamp = ++_queryStamp;
+            for (const auto slot : *postings[i])
+            {
+                if (_entries[slot].queryStamp == stamp)
+                {
+                    _entries[slot].queryStamp = nextStamp;
+                }
+            }
+
+            stamp = nextStamp;
+        }
+
+        // postings may list an object more than once, verified entries are stamped again to skip the repeats
+        const auto verifiedStamp = ++_queryStamp;
+        for (const auto slot : *postings.front())
+        {
+            auto& entry = _entries[slot];
+            if (!entry.object || entry.queryStamp != stamp)
+            {
+                continue;
+            }
+
+            entry.queryStamp = verifiedStamp;
+            if (MatchesLowered(*entry.object, loweredQuery))
+            {
+                result.push_back(entry.object);
+            }
+        }
+
+        return result;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSearchIndex::Matches(const BasicObject& object, const std::string& query)
+    {
+        return !query.empty() && MatchesLowered(object, ToLower(query));
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::Update()
+    {
+        if (!_rebuild)
+        {
+            for (const auto& uuid : _dirtyObjects)
+            {
+                UnindexObject(uuid);
+
+                const auto object = _document.GetObject(uuid);
+                if (object)
+                {
+                    IndexObject(object);
+                }
+            }
+
+            _dirtyObjects.clear();
+        }
+
+        // stale postings only cost time, so they are kept until they outnumber the live ones
+        if (_rebuild || _stalePostingsCount > _livePostingsCount)
+        {
+            Rebuild();
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::Rebuild()
+    {
+        STRTLR_CORE_LOG_INFO("GameDocumentSearchIndex: rebuilding for {} objects", _document.GetObjects().size());
+
+        _slots.clear();
+        _entries.clear();
+        _freeSlots.clear();
+        _postings.clear();
+        _livePostingsCount = 0;
+        _stalePostingsCount = 0;
+
+        const auto& objects = _document.GetObjects();
+        _slots.reserve(objects.size());
+        _entries.reserve(objects.size());
+        for (const auto& object : objects)
+        {
+            IndexObject(object);
+        }
+
+        _rebuild = false;
+        _dirtyObjects.clear();
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::IndexObject(const Ptr<BasicObject>& object)
+    {
+        _trigrams.clear();
+        CollectTrigrams(ToLower(object->GetName()), _trigrams);
+
+        const auto textObject = dynamic_cast<const TextObject*>(object.get());
+        if (textObject)
+        {
+            CollectTrigrams(ToLower(textObject->GetText()), _trigrams);
+        }
+
+        std::sort(_trigrams.begin(), _trigrams.end());
+        _trigrams.erase(std::unique(_trigrams.begin(), _trigrams.end()), _trigrams.end());
+
+        Slot slot;
+        if (_freeSlots.empty())
+        {
+            slot = Slot(_entries.size());
+            _entries.emplace_back();
+        }
+        else
+        {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+
+        _entries[slot] = { object, uint32_t(_trigrams.size()), _queryStamp };
+        _slots.emplace(object->GetUuid(), slot);
+
+        for (const auto trigram : _trigrams)
+        {
+            _postings[trigram].push_back(slot);
+        }
+
+        _livePostingsCount += _trigrams.size();
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::UnindexObject(const UUID& uuid)
+    {
+        const auto it = _slots.find(uuid);
+        if (it == _slots.cend())
+        {
+            return;
+        }
+
+        auto& entry = _entries[it->second];
+        _livePostingsCount -= entry.trigramsCount;
+        _stalePostingsCount += entry.trigramsCount;
+        entry.object.reset();
+
+        _freeSlots.push_back(it->second);
+        _slots.erase(it);
+    }
+    //--------------------------------------------------------------------------
+
+    std::string GameDocumentSearchIndex::ToLower(std::string_view string)
+    {
+        // only ASCII letters are folded, other UTF-8 sequences are compared as is
+        std::string lowered(string);
+        for (auto& c : lowered)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = char(c - 'A' + 'a');
+            }
+        }
+
+        return lowered;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSearchIndex::ContainsLowered(std::string_view string, std::string_view loweredQuery)
+    {
+        const auto it = std::search(string.cbegin(), string.cend(), loweredQuery.cbegin(), loweredQuery.cend(), [](char a, char b) {
+            return (a >= 'A' && a <= 'Z' ? char(a - 'A' + 'a') : a) == b;
+        });
+
+        return it != string.cend();
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSearchIndex::MatchesLowered(const BasicObject& object, std::string_view loweredQuery)
+    {
+        if (ContainsLowered(object.GetName(), loweredQuery))
+        {
+            return true;
+        }
+
+        const auto textObject = dynamic_cast<const TextObject*>(&object);
+        return textObject && ContainsLowered(textObject->GetText(), loweredQuery);
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSearchIndex::CollectTrigrams(std::string_view string, std::vector<Trigram>& trigrams)
+    {
+        for (std::size_t i = 0; i + 2 < string.size(); i++)
+        {
+            trigrams.push_back(Trigram(uint8_t(string[i])) << 16 | Trigram(uint8_t(string[i + 1])) << 8 | Trigram(uint8_t(string[i + 2])));
+        }
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
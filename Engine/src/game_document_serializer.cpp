@@ -2,30 +2,38 @@
 #include "log.h"
 #include "entities.h"
 #include "filesystem.h"
-#include "json_reader.h"
 #include "json_writer.h"
+#include "game_document_json_keys.h"
+#include "game_document_sax_handler.h"
+#include "game_document_binary_format.h"
+#include "memory_mapped_file.h"
+#include "platform.h"
+
+#include <rapidjson/reader.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/error/en.h>
 
 #include <fstream>
+#include <memory>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <cstring>
 
 namespace Storyteller
 {
-#define JSON_KEY_GAME_NAME "GameName"
-#define JSON_KEY_GAME_DOMAIN_NAME "GameDomainName"
-#define JSON_KEY_ENTRY_POINT_UUID "EntryPointUuid"
-#define JSON_KEY_OBJECTS "Objects"
-#define JSON_KEY_UUID "UUID"
-#define JSON_KEY_NAME "Name"
-#define JSON_KEY_OBJECT_TYPE "ObjectType"
-#define JSON_KEY_TEXT "Text"
-#define JSON_KEY_ACTIONS "Actions"
-#define JSON_KEY_TARGET "Target"
-#define JSON_KEY_FINAL "Final"
-
     GameDocumentSerializer::GameDocumentSerializer(const Ptr<GameDocument> document)
         : _document(document)
+        , _progressCallback(nullptr)
     {}
     //--------------------------------------------------------------------------
 
+    void GameDocumentSerializer::SetProgressCallback(const ProgressCallback& progressCallback)
+    {
+        _progressCallback = progressCallback;
+    }
+    //--------------------------------------------------------------------------
+
     bool GameDocumentSerializer::Load(const std::filesystem::path& path)
     {
         STRTLR_CORE_LOG_INFO("GameDocumentSerializer: load from '{}'", Filesystem::ToU8String(path));
@@ -36,15 +44,20 @@ namespace Storyteller
             return false;
         }
 
-        const auto ok = Deserialize(path);
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto ok = IsBinaryPath(path) ? DeserializeBinary(path) : Deserialize(path);
         if (!ok)
         {
             STRTLR_CORE_LOG_WARN("GameDocumentSerializer: deserialization failed");
             return false;
         }
 
+        const auto loadTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+        STRTLR_CORE_LOG_INFO("GameDocumentSerializer: loaded {} objects in {} ms", _document->GetObjects().size(), loadTime.count());
+
         _document->SetPath(path);
         _document->SetDirty(false);
+        _document->ResetChanges();
 
         return true;
     }
@@ -66,7 +79,7 @@ namespace Storyteller
             return false;
         }
 
-        const auto ok = Serialize(path);
+        const auto ok = IsBinaryPath(path) ? SerializeBinary(path) : Serialize(path);
         if (!ok)
         {
             STRTLR_CORE_LOG_WARN("GameDocumentSerializer: serialization failed");
@@ -80,6 +93,12 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
+    bool GameDocumentSerializer::IsBinaryPath(const std::filesystem::path& path)
+    {
+        return path.extension() == STRTLR_BINARY_DOCUMENT_EXTENSION;
+    }
+    //--------------------------------------------------------------------------
+
     bool GameDocumentSerializer::Serialize(const std::filesystem::path& path) const
     {
         JsonWriter writer(path);
@@ -141,6 +160,7 @@ namespace Storyteller
             }
 
             ok &= writer.EndObject();
+            ReportProgress(i + 1, objects.size());
         }
 
         ok &= writer.EndArray();
@@ -152,69 +172,270 @@ namespace Storyteller
 
     bool GameDocumentSerializer::Deserialize(const std::filesystem::path& path)
     {
-        JsonReader reader(path);
+#if defined STRTLR_PLATFORM_WINDOWS
+        const std::unique_ptr<std::FILE, decltype(&std::fclose)> file(_wfopen(path.c_str(), L"rb"), &std::fclose);
+#else
+        const std::unique_ptr<std::FILE, decltype(&std::fclose)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+#endif
+        if (!file)
+        {
+            return false;
+        }
 
-        if (!reader.Start())
+        // SAX parsing over a fixed read buffer keeps memory bounded by the largest object instead of the whole DOM
+        constexpr auto readBufferSize = 64 * 1024;
+        std::vector<char> readBuffer(readBufferSize);
+        rapidjson::FileReadStream jsonStream(file.get(), readBuffer.data(), readBuffer.size());
+        rapidjson::Reader reader;
+        GameDocumentSaxHandler handler(_document);
+
+        const auto result = reader.Parse(jsonStream, handler);
+        if (result.IsError())
         {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: JSON parsing error '{}' at offset {}", rapidjson::GetParseError_En(result.Code()), result.Offset());
             return false;
         }
 
-        _document->SetGameName(reader.GetString(JSON_KEY_GAME_NAME, "Untitled"));
-        _document->SetDomainName(reader.GetString(JSON_KEY_GAME_DOMAIN_NAME, "Untitled"));
-        _document->SetEntryPoint(UUID(reader.GetUInt64(JSON_KEY_ENTRY_POINT_UUID, UUID::InvalidUuid)));
-        const auto objectsArraySize = reader.StartArray(JSON_KEY_OBJECTS);
+        return handler.IsFinished();
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSerializer::SerializeBinary(const std::filesystem::path& path) const
+    {
+        const auto& objects = _document->GetObjects();
+        const auto gameName = _document->GetGameName();
+        const auto domainName = _document->GetDomainName();
+        const auto entryPoint = _document->GetEntryPoint();
 
-        for (auto i = 0; i < objectsArraySize; i++)
+        BinaryFormat::Header header = {};
+        std::memcpy(header.magic, BinaryFormat::Magic, sizeof(header.magic));
+        header.version = BinaryFormat::Version;
+        header.entryPointUuid = entryPoint ? entryPoint->GetUuid() : UUID::InvalidUuid;
+        header.objectsOffset = sizeof(BinaryFormat::Header);
+        header.objectsCount = objects.size();
+        header.gameNameOffset = 0;
+        header.gameNameSize = uint32_t(gameName.size());
+        header.domainNameOffset = header.gameNameSize;
+        header.domainNameSize = uint32_t(domainName.size());
+
+        // sizes are known upfront, so every section is written in a single pass without buffering
+        uint64_t stringsSize = uint64_t(gameName.size()) + domainName.size();
+        for (const auto& object : objects)
         {
-            reader.StartArrayObject(i);
+            const auto textObject = dynamic_cast<const TextObject*>(object.get());
+            stringsSize += object->GetName().size() + (textObject ? textObject->GetText().size() : 0);
 
-            const auto objectUuid = UUID(reader.GetUInt64(JSON_KEY_UUID));
-            const auto objectName = reader.GetString(JSON_KEY_NAME);
-            const auto objectType = StringToObjectType(reader.GetString(JSON_KEY_OBJECT_TYPE));
-            const auto objectText = reader.GetString(JSON_KEY_TEXT);
+            const auto questObject = dynamic_cast<const QuestObject*>(object.get());
+            header.actionsCount += questObject ? questObject->GetActions().size() : 0;
+        }
 
-            switch (objectType)
+        if (stringsSize > std::numeric_limits<uint32_t>::max())
+        {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: string table size {} exceeds binary format limit", stringsSize);
+            return false;
+        }
+
+        header.actionsOffset = header.objectsOffset + header.objectsCount * sizeof(BinaryFormat::ObjectRecord);
+        header.stringsOffset = header.actionsOffset + header.actionsCount * sizeof(uint64_t);
+        header.stringsSize = stringsSize;
+
+        // written to a temporary file which replaces the target only when complete, as JsonWriter does
+        const auto temporaryPath = std::filesystem::path(path).concat(".tmp");
+        std::ofstream outputStream(temporaryPath, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!outputStream.is_open() || !outputStream.good())
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentSerializer: failed to open file stream");
+            return false;
+        }
+
+        outputStream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        auto stringOffset = header.domainNameOffset + header.domainNameSize;
+        auto actionsIndex = 0u;
+        for (const auto& object : objects)
+        {
+            const auto textObject = dynamic_cast<const TextObject*>(object.get());
+
+            BinaryFormat::ObjectRecord record = {};
+            record.uuid = object->GetUuid();
+            record.objectType = uint8_t(object->GetObjectType());
+            record.nameOffset = stringOffset;
+            record.nameSize = uint32_t(object->GetName().size());
+            record.textOffset = record.nameOffset + record.nameSize;
+            record.textSize = textObject ? uint32_t(textObject->GetText().size()) : 0;
+            record.actionsIndex = actionsIndex;
+
+            if (const auto questObject = dynamic_cast<const QuestObject*>(object.get()))
+            {
+                record.actionsCount = uint32_t(questObject->GetActions().size());
+                record.final = questObject->IsFinal();
+            }
+            else if (const auto actionObject = dynamic_cast<const ActionObject*>(object.get()))
+            {
+                record.targetUuid = actionObject->GetTargetUuid();
+            }
+
+            stringOffset = record.textOffset + record.textSize;
+            actionsIndex += record.actionsCount;
+
+            outputStream.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        }
+
+        for (const auto& object : objects)
+        {
+            if (const auto questObject = dynamic_cast<const QuestObject*>(object.get()))
+            {
+                for (const auto& actionUuid : questObject->GetActions())
+                {
+                    const uint64_t rawUuid = actionUuid;
+                    outputStream.write(reinterpret_cast<const char*>(&rawUuid), sizeof(rawUuid));
+                }
+            }
+        }
+
+        outputStream.write(gameName.data(), gameName.size());
+        outputStream.write(domainName.data(), domainName.size());
+        for (auto i = 0; i < objects.size(); i++)
+        {
+            const auto& object = objects.at(i);
+            const auto textObject = dynamic_cast<const TextObject*>(object.get());
+            outputStream.write(object->GetName().data(), object->GetName().size());
+            if (textObject)
+            {
+                outputStream.write(textObject->GetText().data(), textObject->GetText().size());
+            }
+
+            ReportProgress(i + 1, objects.size());
+        }
+
+        outputStream.close();
+
+        std::error_code error;
+        if (outputStream.fail() || !Filesystem::DurableRename(temporaryPath, path, error))
+        {
+            STRTLR_CORE_LOG_WARN("GameDocumentSerializer: failed to replace '{}', {}", Filesystem::ToU8String(path), error.message());
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSerializer::DeserializeBinary(const std::filesystem::path& path)
+    {
+        MemoryMappedFile file;
+        if (!file.Open(path))
+        {
+            return false;
+        }
+
+        const auto data = file.GetData();
+        const auto size = file.GetSize();
+        if (size < sizeof(BinaryFormat::Header))
+        {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: binary document is truncated");
+            return false;
+        }
+
+        // the mapping is page aligned and all sections are 8-byte aligned, so records are read in place
+        const auto& header = *reinterpret_cast<const BinaryFormat::Header*>(data);
+        if (std::memcmp(header.magic, BinaryFormat::Magic, sizeof(header.magic)) != 0 || header.version != BinaryFormat::Version)
+        {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: unsupported binary document, version {}", header.version);
+            return false;
+        }
+
+        // counts are bounded by the remaining size before they are multiplied, so the offsets cannot wrap
+        if (header.objectsOffset != sizeof(BinaryFormat::Header)
+            || header.objectsCount > (size - header.objectsOffset) / sizeof(BinaryFormat::ObjectRecord)
+            || header.actionsOffset != header.objectsOffset + header.objectsCount * sizeof(BinaryFormat::ObjectRecord)
+            || header.actionsCount > (size - header.actionsOffset) / sizeof(uint64_t)
+            || header.stringsOffset != header.actionsOffset + header.actionsCount * sizeof(uint64_t)
+            || header.stringsSize != size - header.stringsOffset
+            || uint64_t(header.gameNameOffset) + header.gameNameSize > header.stringsSize
+            || uint64_t(header.domainNameOffset) + header.domainNameSize > header.stringsSize)
+        {
+            STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: binary document sections are inconsistent");
+            return false;
+        }
+
+        const auto records = reinterpret_cast<const BinaryFormat::ObjectRecord*>(data + header.objectsOffset);
+        const auto actions = reinterpret_cast<const uint64_t*>(data + header.actionsOffset);
+        const auto strings = reinterpret_cast<const char*>(data + header.stringsOffset);
+
+        _document->SetGameName(std::string(strings + header.gameNameOffset, header.gameNameSize));
+        _document->SetDomainName(std::string(strings + header.domainNameOffset, header.domainNameSize));
+        _document->SetEntryPoint(UUID(header.entryPointUuid));
+
+        // the records are checked and built first, then the document takes them all at once
+        std::vector<Ptr<BasicObject>> objects;
+        objects.reserve(header.objectsCount);
+        for (auto i = 0ull; i < header.objectsCount; i++)
+        {
+            const auto& record = records[i];
+            if (uint64_t(record.nameOffset) + record.nameSize > header.stringsSize
+                || uint64_t(record.textOffset) + record.textSize > header.stringsSize
+                || uint64_t(record.actionsIndex) + record.actionsCount > header.actionsCount)
+            {
+                STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: binary object record ({}) is out of bounds", record.uuid);
+                return false;
+            }
+
+            const auto objectUuid = UUID(record.uuid);
+            const auto objectName = std::string(strings + record.nameOffset, record.nameSize);
+            const auto objectText = std::string(strings + record.textOffset, record.textSize);
+
+            switch (ObjectType(record.objectType))
             {
             case ObjectType::QuestObjectType:
             {
-                auto questObject = CreatePtr<QuestObject>(objectUuid, [this]() { _document->SetDirty(true); });
+                auto questObject = CreatePtr<QuestObject>(objectUuid);
                 questObject->SetText(objectText);
                 questObject->SetName(objectName);
 
-                const auto questObjectActionsSize = reader.StartArray(JSON_KEY_ACTIONS);
-                for (auto a = 0; a < questObjectActionsSize; a++)
+                for (auto a = 0u; a < record.actionsCount; a++)
                 {
-                    questObject->AddAction(UUID(reader.GetUInt64(a)));
+                    questObject->AddAction(UUID(actions[record.actionsIndex + a]));
                 }
-                reader.EndArray();
-                
-                questObject->SetFinal(reader.GetBool(JSON_KEY_FINAL));
 
-                _document->AddObject(questObject);
+                questObject->SetFinal(record.final != 0);
 
+                objects.push_back(questObject);
                 break;
             }
 
             case ObjectType::ActionObjectType:
             {
-                auto actionObject = CreatePtr<ActionObject>(objectUuid, [this]() { _document->SetDirty(true); });
-                actionObject->SetTargetUuid(UUID(reader.GetUInt64(JSON_KEY_TARGET)));
+                auto actionObject = CreatePtr<ActionObject>(objectUuid);
+                actionObject->SetTargetUuid(UUID(record.targetUuid));
                 actionObject->SetText(objectText);
                 actionObject->SetName(objectName);
 
-                _document->AddObject(actionObject);
-
+                objects.push_back(actionObject);
                 break;
             }
 
             default:
+                STRTLR_CORE_LOG_ERROR("GameDocumentSerializer: binary object record ({}) has unknown type {}", record.uuid, record.objectType);
                 return false;
             }
-
-            reader.EndArrayObject();
         }
 
+        _document->AddObjects(objects);
+
         return true;
     }
     //--------------------------------------------------------------------------
+
+    void GameDocumentSerializer::ReportProgress(std::size_t current, std::size_t total) const
+    {
+        // reported in steps to keep the callback off the hot path
+        constexpr auto progressStep = 1024;
+        if (_progressCallback && (current % progressStep == 0 || current == total))
+        {
+            _progressCallback(total ? float(current) / float(total) : 1.0f);
+        }
+    }
+    //--------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -1,11 +1,78 @@
 #include "game_document_sort_filter_proxy_view.h"
+#include "game_document_search_index.h"
 #include "log.h"
 
+#include <algorithm>
+#include <locale>
+#include <string_view>
+
 namespace Storyteller
 {
-    GameDocumentSortFilterProxyView::Sorter::Sorter(bool ascending, SortValue sortValue)
+    namespace
+    {
+        // compact stand-in for an object during a full sort
+        struct SortKey
+        {
+            uint64_t prefix;
+            UUID uuid;
+            uint32_t index;
+        };
+        //--------------------------------------------------------------------------
+
+        // bytes of a string from the offset packed big-endian, so integer order matches bytewise order
+        uint64_t PackPrefix(std::string_view string, std::size_t offset = 0)
+        {
+            uint64_t prefix = 0;
+            for (auto i = offset; i < offset + sizeof(uint64_t); i++)
+            {
+                prefix = (prefix << 8) | (i < string.size() ? uint8_t(string[i]) : 0);
+            }
+
+            return prefix;
+        }
+        //--------------------------------------------------------------------------
+
+        template<typename Less>
+        void SortKeys(std::vector<SortKey>::iterator begin, std::vector<SortKey>::iterator end, const Less& less)
+        {
+            std::sort(begin, end, less);
+        }
+        //--------------------------------------------------------------------------
+
+        // multikey sort of strings: keys are ordered by 8 bytes at a time, and only the runs
+        // that are still equal get the next 8 bytes loaded, so comparisons stay within the keys
+        template<typename Less>
+        void SortKeys(std::vector<SortKey>::iterator begin, std::vector<SortKey>::iterator end, const Less& less, const std::vector<std::string_view>& strings, std::size_t offset)
+        {
+            for (auto it = begin; it != end; ++it)
+            {
+                it->prefix = PackPrefix(strings[it->index], offset);
+            }
+
+            std::sort(begin, end, less);
+
+            const auto nextOffset = offset + sizeof(uint64_t);
+            for (auto runBegin = begin; runBegin != end;)
+            {
+                const auto runEnd = std::find_if(runBegin + 1, end, [&](const SortKey& key) { return key.prefix != runBegin->prefix; });
+                // the run is in UUID order at this point, so its first key may be a short one that ends here
+                const auto hasMoreBytes = std::any_of(runBegin, runEnd, [&](const SortKey& key) { return strings[key.index].size() > nextOffset; });
+                if (runEnd - runBegin > 1 && hasMoreBytes)
+                {
+                    SortKeys(runBegin, runEnd, less, strings, nextOffset);
+                }
+
+                runBegin = runEnd;
+            }
+        }
+        //--------------------------------------------------------------------------
+    }
+    //--------------------------------------------------------------------------
+
+    GameDocumentSortFilterProxyView::Sorter::Sorter(bool ascending, SortValue sortValue, bool localeAware)
         : sortValue(sortValue)
         , ascending(ascending)
+        , localeAware(localeAware)
         , active(false)
     {}
     //--------------------------------------------------------------------------
@@ -15,23 +82,47 @@ namespace Storyteller
         switch (sortValue)
         {
         case Type:
-            return ascending
-                ? (a->GetObjectType() < b->GetObjectType())
-                : (a->GetObjectType() > b->GetObjectType());
+            if (a->GetObjectType() != b->GetObjectType())
+            {
+                return ascending
+                    ? (a->GetObjectType() < b->GetObjectType())
+                    : (a->GetObjectType() > b->GetObjectType());
+            }
+            break;
 
         case Uuid:
-            return ascending
-                ? (a->GetUuid() < b->GetUuid())
-                : (a->GetUuid() > b->GetUuid());
+            break;
 
         case Name:
-            return ascending
-                ? (a->GetName() < b->GetName())
-                : (a->GetName() > b->GetName());
+        {
+            const auto order = CompareNames(a->GetName(), b->GetName());
+            if (order != 0)
+            {
+                return ascending ? (order < 0) : (order > 0);
+            }
+            break;
+        }
 
         default:
-            return true;
+            return false;
         }
+
+        // equal values are ordered by UUID, so every object has exactly one position to search for
+        return ascending
+            ? (a->GetUuid() < b->GetUuid())
+            : (a->GetUuid() > b->GetUuid());
+    }
+    //--------------------------------------------------------------------------
+
+    int GameDocumentSortFilterProxyView::Sorter::CompareNames(const std::string& a, const std::string& b) const
+    {
+        if (localeAware)
+        {
+            const auto& collate = std::use_facet<std::collate<char>>(std::locale());
+            return collate.compare(a.data(), a.data() + a.size(), b.data(), b.data() + b.size());
+        }
+
+        return a.compare(b);
     }
     //--------------------------------------------------------------------------
 
@@ -41,22 +132,24 @@ namespace Storyteller
     {}
     //--------------------------------------------------------------------------
 
-    bool GameDocumentSortFilterProxyView::Filter::Accept(ObjectType type) const
+    bool GameDocumentSortFilterProxyView::Filter::Accept(const BasicObject& object) const
     {
-        return filterTypes.contains(type);
+        return filterTypes.contains(object.GetObjectType()) && (query.empty() || matches.contains(object.GetUuid()));
     }
     //--------------------------------------------------------------------------
 
     bool GameDocumentSortFilterProxyView::Filter::NeedFilter() const
     {
         return !filterTypes.contains(ObjectType::QuestObjectType) ||
-            !filterTypes.contains(ObjectType::ActionObjectType);
+            !filterTypes.contains(ObjectType::ActionObjectType) ||
+            !query.empty();
     }
     //--------------------------------------------------------------------------
 
     GameDocumentSortFilterProxyView::GameDocumentSortFilterProxyView(const Ptr<GameDocument> document)
         : _document(document)
-        , _cache(document->GetObjects())
+        , _sortedObjects(document->GetObjects())
+        , _cache(_sortedObjects)
         , _selectedUuid(UUID::InvalidUuid)
         , _sorter()
     {
@@ -77,7 +170,7 @@ namespace Storyteller
             return false;
         }
 
-        UpdateView();
+        InsertObject(_document->GetObject(uuid));
 
         Select(uuid);
         return true;
@@ -91,7 +184,7 @@ namespace Storyteller
             return false;
         }
 
-        UpdateView();
+        InsertObject(object);
 
         Select(object->GetUuid());
         return true;
@@ -100,12 +193,13 @@ namespace Storyteller
 
     bool GameDocumentSortFilterProxyView::RemoveObject(const UUID& uuid)
     {
+        const auto object = _document->GetObject(uuid);
         if (!_document->RemoveObject(uuid))
         {
             return false;
         }
 
-        UpdateView();
+        EraseObject(object);
 
         if (IsSelected(uuid))
         {
@@ -116,6 +210,30 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
+    std::size_t GameDocumentSortFilterProxyView::RemoveObjects(const std::vector<UUID>& uuids)
+    {
+        const auto removedCount = _document->RemoveObjects(uuids);
+        if (removedCount == 0)
+        {
+            return 0;
+        }
+
+        // one pass over the view instead of a search per removed object
+        const auto removed = [this](const Ptr<BasicObject>& object) { return !_document->GetObject(object->GetUuid()); };
+        std::erase_if(_sortedObjects, removed);
+        std::erase_if(_cache, removed);
+        std::erase_if(_searchResults, removed);
+        std::erase_if(_filter.matches, [this](const UUID& uuid) { return !_document->GetObject(uuid); });
+
+        if (!_document->GetObject(_selectedUuid))
+        {
+            Select(UUID::InvalidUuid);
+        }
+
+        return removedCount;
+    }
+    //--------------------------------------------------------------------------
+
     Ptr<BasicObject> GameDocumentSortFilterProxyView::GetObject(const UUID& uuid) const
     {
         return _document->GetObject(uuid);
@@ -152,9 +270,75 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
-    bool GameDocumentSortFilterProxyView::SetObjectName(const UUID& uuid, const std::string& name) const
+    bool GameDocumentSortFilterProxyView::SetObjectName(const UUID& uuid, const std::string& name)
+    {
+        // the position is looked up by the current name, so the object is taken out before renaming
+        const auto object = _document->GetObject(uuid);
+        const auto reposition = object && ((_sorter.active && _sorter.sortValue == Sorter::Name) || !_filter.query.empty());
+        if (reposition)
+        {
+            EraseObject(object);
+        }
+
+        const auto renamed = _document->SetObjectName(uuid, name);
+
+        if (reposition)
+        {
+            InsertObject(object);
+        }
+
+        return renamed;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSortFilterProxyView::SetObjectText(const UUID& uuid, const std::string& text)
+    {
+        const auto object = _document->GetObject(uuid);
+        const auto textObject = std::dynamic_pointer_cast<TextObject>(object);
+        if (!textObject)
+        {
+            return false;
+        }
+
+        // the text decides only whether the object matches the search query, not its sort position
+        const auto research = !_filter.query.empty();
+        if (research)
+        {
+            EraseObject(object);
+        }
+
+        textObject->SetText(text);
+
+        if (research)
+        {
+            InsertObject(object);
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    bool GameDocumentSortFilterProxyView::IsConsistent(const UUID& uuid) const
+    {
+        return _document->IsObjectConsistent(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Diagnostic> GameDocumentSortFilterProxyView::GetDiagnostics(const UUID& uuid) const
+    {
+        return _document->GetObjectDiagnostics(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<UUID> GameDocumentSortFilterProxyView::GetActionsTargeting(const UUID& uuid) const
+    {
+        return _document->GetActionsTargeting(uuid);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<UUID> GameDocumentSortFilterProxyView::GetQuestsContaining(const UUID& actionUuid) const
     {
-        return _document->SetObjectName(uuid, name);
+        return _document->GetQuestsContaining(actionUuid);
     }
     //--------------------------------------------------------------------------
 
@@ -194,10 +378,11 @@ namespace Storyteller
             return nullptr;
         }
 
-        const auto it = std::find_if(_cache.cbegin(), _cache.cend(), [&](const Ptr<BasicObject>& obj) { return obj->GetUuid() == _selectedUuid; });
-        if (it != _cache.cend())
+        // an object is in the view exactly when the filter accepts it
+        const auto object = _document->GetObject(_selectedUuid);
+        if (object && _filter.Accept(*object))
         {
-            return *it;
+            return object;
         }
 
         return nullptr;
@@ -208,17 +393,31 @@ namespace Storyteller
     {
         STRTLR_CORE_LOG_INFO("GameDocumentSortFilterProxyView: updating cache");
 
-        _cache = _document->GetObjects();
+        _sortedObjects = _document->GetObjects();
+        if (_sorter.active)
+        {
+            DoSort();
+        }
+
+        if (!_filter.query.empty())
+        {
+            DoSearch(std::string(_filter.query));
+        }
+        else if (!_sorter.active)
+        {
+            DoFilter();
+        }
     }
     //--------------------------------------------------------------------------
 
-    void GameDocumentSortFilterProxyView::DoSort(bool ascending, Sorter::SortValue sortValue)
+    void GameDocumentSortFilterProxyView::DoSort(bool ascending, Sorter::SortValue sortValue, bool localeAware)
     {
-        STRTLR_CORE_LOG_INFO("GameDocumentSortFilterProxyView: sorting '{}', ascending: '{}'", sortValue, ascending);
+        STRTLR_CORE_LOG_INFO("GameDocumentSortFilterProxyView: sorting '{}', ascending: '{}', locale aware: '{}'", sortValue, ascending, localeAware);
 
         _sorter.active = true;
         _sorter.ascending = ascending;
         _sorter.sortValue = sortValue;
+        _sorter.localeAware = localeAware;
         DoSort();
     }
     //--------------------------------------------------------------------------
@@ -241,34 +440,181 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
-    void GameDocumentSortFilterProxyView::UpdateView()
+    void GameDocumentSortFilterProxyView::DoSearch(const std::string& query)
     {
-        STRTLR_CORE_LOG_INFO("GameDocumentSortFilterProxyView: updating view");
+        STRTLR_CORE_LOG_INFO("GameDocumentSortFilterProxyView: searching '{}'", query);
 
-        UpdateCache();
+        _filter.active = true;
+        _filter.query = query;
+        _filter.matches.clear();
+        _searchResults = _document->FindObjects(query);
+        for (const auto& object : _searchResults)
+        {
+            _filter.matches.insert(object->GetUuid());
+        }
 
-        if (_sorter.active)
+        DoFilter();
+    }
+    //--------------------------------------------------------------------------
+
+    const std::string& GameDocumentSortFilterProxyView::GetSearchQuery() const
+    {
+        return _filter.query;
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSortFilterProxyView::DoSort()
+    {
+        // keys are gathered in one pass, so the sort compares a compact array instead of chasing objects
+        std::vector<SortKey> keys;
+        keys.reserve(_sortedObjects.size());
+        for (uint32_t i = 0; i < uint32_t(_sortedObjects.size()); i++)
         {
-            DoSort();
+            const auto& object = _sortedObjects[i];
+            const auto prefix = _sorter.sortValue == Sorter::Type ? uint64_t(object->GetObjectType()) : 0;
+            keys.push_back({ prefix, object->GetUuid(), i });
         }
 
-        if (_filter.active && _filter.NeedFilter())
+        const auto ascending = _sorter.ascending;
+        const auto less = [ascending](const SortKey& a, const SortKey& b) {
+            if (a.prefix != b.prefix)
+            {
+                return ascending ? (a.prefix < b.prefix) : (a.prefix > b.prefix);
+            }
+
+            return ascending ? (a.uuid < b.uuid) : (a.uuid > b.uuid);
+        };
+
+        if (_sorter.sortValue == Sorter::Name)
         {
-            DoFilter();
+            // collation keys compare bytewise the same way the names collate
+            std::vector<std::string> collationKeys;
+            std::vector<std::string_view> names;
+            names.reserve(_sortedObjects.size());
+            if (_sorter.localeAware)
+            {
+                const auto& collate = std::use_facet<std::collate<char>>(std::locale());
+                collationKeys.reserve(_sortedObjects.size());
+                for (const auto& object : _sortedObjects)
+                {
+                    const auto& name = object->GetName();
+                    collationKeys.push_back(collate.transform(name.data(), name.data() + name.size()));
+                }
+
+                names.assign(collationKeys.cbegin(), collationKeys.cend());
+            }
+            else
+            {
+                for (const auto& object : _sortedObjects)
+                {
+                    names.push_back(object->GetName());
+                }
+            }
+
+            SortKeys(keys.begin(), keys.end(), less, names, 0);
         }
+        else
+        {
+            SortKeys(keys.begin(), keys.end(), less);
+        }
+
+        std::vector<Ptr<BasicObject>> sortedObjects;
+        sortedObjects.reserve(_sortedObjects.size());
+        for (const auto& key : keys)
+        {
+            sortedObjects.push_back(std::move(_sortedObjects[key.index]));
+        }
+
+        std::swap(_sortedObjects, sortedObjects);
+        DoFilter();
     }
+    //--------------------------------------------------------------------------
 
-    void GameDocumentSortFilterProxyView::DoSort()
+    void GameDocumentSortFilterProxyView::DoFilter()
     {
-        std::sort(_cache.begin(), _cache.end(), _sorter);
+        // search results are usually few, so they are sorted on their own instead of filtering all objects
+        if (!_filter.query.empty())
+        {
+            _cache.clear();
+            std::copy_if(_searchResults.cbegin(), _searchResults.cend(), std::back_inserter(_cache), [&](const Ptr<BasicObject>& obj) { return _filter.Accept(*obj); });
+            if (_sorter.active)
+            {
+                std::sort(_cache.begin(), _cache.end(), _sorter);
+            }
+
+            return;
+        }
+
+        // the sorted objects stay as they are, the view is refilled in place without reallocation
+        if (!_filter.NeedFilter())
+        {
+            _cache.assign(_sortedObjects.cbegin(), _sortedObjects.cend());
+            return;
+        }
+
+        _cache.clear();
+        std::copy_if(_sortedObjects.cbegin(), _sortedObjects.cend(), std::back_inserter(_cache), [&](const Ptr<BasicObject>& obj) { return _filter.Accept(*obj); });
     }
     //--------------------------------------------------------------------------
 
-    void GameDocumentSortFilterProxyView::DoFilter()
+    void GameDocumentSortFilterProxyView::InsertObject(const Ptr<BasicObject>& object)
+    {
+        _sortedObjects.insert(FindInsertPosition(_sortedObjects, object), object);
+
+        if (!_filter.query.empty() && GameDocumentSearchIndex::Matches(*object, _filter.query) && _filter.matches.insert(object->GetUuid()).second)
+        {
+            _searchResults.push_back(object);
+        }
+
+        if (_filter.Accept(*object))
+        {
+            _cache.insert(FindInsertPosition(_cache, object), object);
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void GameDocumentSortFilterProxyView::EraseObject(const Ptr<BasicObject>& object)
+    {
+        const auto sortedIt = FindPosition(_sortedObjects, object);
+        if (sortedIt != _sortedObjects.end())
+        {
+            _sortedObjects.erase(sortedIt);
+        }
+
+        const auto cacheIt = FindPosition(_cache, object);
+        if (cacheIt != _cache.end())
+        {
+            _cache.erase(cacheIt);
+        }
+
+        if (_filter.matches.erase(object->GetUuid()))
+        {
+            _searchResults.erase(std::find(_searchResults.begin(), _searchResults.end(), object));
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Ptr<BasicObject>>::iterator GameDocumentSortFilterProxyView::FindPosition(std::vector<Ptr<BasicObject>>& objects, const Ptr<BasicObject>& object) const
+    {
+        if (_sorter.active)
+        {
+            const auto it = std::lower_bound(objects.begin(), objects.end(), object, _sorter);
+            if (it != objects.end() && *it == object)
+            {
+                return it;
+            }
+        }
+
+        // unsorted view, or the object was changed behind the view's back
+        return std::find(objects.begin(), objects.end(), object);
+    }
+    //--------------------------------------------------------------------------
+
+    std::vector<Ptr<BasicObject>>::iterator GameDocumentSortFilterProxyView::FindInsertPosition(std::vector<Ptr<BasicObject>>& objects, const Ptr<BasicObject>& object) const
     {
-        std::vector<Ptr<BasicObject>> temp;
-        std::copy_if(_cache.cbegin(), _cache.cend(), std::back_inserter(temp), [&](const Ptr<BasicObject>& obj) { return _filter.Accept(obj->GetObjectType()); });
-        std::swap(_cache, temp);
+        return _sorter.active
+            ? std::upper_bound(objects.begin(), objects.end(), object, _sorter)
+            : objects.end();
     }
     //--------------------------------------------------------------------------
     //--------------------------------------------------------------------------
@@ -0,0 +1,538 @@
+#include "i18n_catalog.h"
+#include "i18n_catalog_format.h"
+#include "filesystem.h"
+#include "log.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <fstream>
+#include <cstring>
+
+namespace Storyteller
+{
+    namespace I18N
+    {
+        namespace
+        {
+            constexpr uint32_t InvalidSlot = uint32_t(-1);
+            constexpr uint32_t MaxSeed = 1u << 24;
+            constexpr uint32_t MaxHashSalt = 16;
+
+            uint64_t AlignUp(uint64_t value)
+            {
+                return (value + 7) & ~uint64_t(7);
+            }
+            //--------------------------------------------------------------------------
+
+            // hash and displace: the largest buckets are placed first while most slots are free,
+            // single message buckets take the remaining slots directly
+            bool PlaceMessages(const std::vector<uint64_t>& hashes, uint32_t bucketsCount, std::vector<uint32_t>& seeds, std::vector<uint32_t>& slots)
+            {
+                const auto messagesCount = uint32_t(hashes.size());
+
+                auto sortedHashes = hashes;
+                std::sort(sortedHashes.begin(), sortedHashes.end());
+                if (std::adjacent_find(sortedHashes.cbegin(), sortedHashes.cend()) != sortedHashes.cend())
+                {
+                    return false;
+                }
+
+                std::vector<std::vector<uint32_t>> buckets(bucketsCount);
+                for (auto i = 0u; i < messagesCount; i++)
+                {
+                    buckets[CatalogFormat::GetBucket(hashes[i], bucketsCount)].push_back(i);
+                }
+
+                std::vector<uint32_t> order(bucketsCount);
+                std::iota(order.begin(), order.end(), 0u);
+                std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+                seeds.assign(bucketsCount, 0);
+                slots.assign(messagesCount, InvalidSlot);
+
+                std::vector<uint32_t> bucketSlots;
+                auto nextFreeSlot = 0u;
+                for (const auto bucketIndex : order)
+                {
+                    const auto& bucket = buckets[bucketIndex];
+                    if (bucket.empty())
+                    {
+                        break;
+                    }
+
+                    if (bucket.size() == 1)
+                    {
+                        while (slots[nextFreeSlot] != InvalidSlot)
+                        {
+                            ++nextFreeSlot;
+                        }
+
+                        seeds[bucketIndex] = CatalogFormat::DirectSlotFlag | nextFreeSlot;
+                        slots[nextFreeSlot] = bucket.front();
+                        continue;
+                    }
+
+                    auto placed = false;
+                    for (auto seed = 0u; seed < MaxSeed && !placed; seed++)
+                    {
+                        bucketSlots.clear();
+                        placed = true;
+                        for (const auto message : bucket)
+                        {
+                            const auto slot = CatalogFormat::GetSlot(hashes[message], seed, messagesCount);
+                            if (slots[slot] != InvalidSlot || std::find(bucketSlots.cbegin(), bucketSlots.cend(), slot) != bucketSlots.cend())
+                            {
+                                placed = false;
+                                break;
+                            }
+
+                            bucketSlots.push_back(slot);
+                        }
+
+                        if (placed)
+                        {
+                            for (auto i = 0u; i < bucket.size(); i++)
+                            {
+                                slots[bucketSlots[i]] = bucket[i];
+                            }
+
+                            seeds[bucketIndex] = seed;
+                        }
+                    }
+
+                    if (!placed)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+            //--------------------------------------------------------------------------
+
+            // value of a quoted .po string with its escapes resolved
+            std::string UnquotePoString(std::string_view line)
+            {
+                const auto begin = line.find('"');
+                const auto end = line.rfind('"');
+                if (begin == std::string_view::npos || end <= begin)
+                {
+                    return std::string();
+                }
+
+                std::string value;
+                value.reserve(end - begin - 1);
+                for (auto i = begin + 1; i < end; i++)
+                {
+                    if (line[i] != '\\' || i + 1 == end)
+                    {
+                        value.push_back(line[i]);
+                        continue;
+                    }
+
+                    switch (line[++i])
+                    {
+                    case 'n':
+                        value.push_back('\n');
+                        break;
+
+                    case 't':
+                        value.push_back('\t');
+                        break;
+
+                    case 'r':
+                        value.push_back('\r');
+                        break;
+
+                    default:
+                        value.push_back(line[i]);
+                        break;
+                    }
+                }
+
+                return value;
+            }
+            //--------------------------------------------------------------------------
+        }
+
+        bool Catalog::Open(const std::filesystem::path& path)
+        {
+            Close();
+
+            if (!_file.Open(path))
+            {
+                return false;
+            }
+
+            const auto data = _file.GetData();
+            const auto size = _file.GetSize();
+            if (size < sizeof(CatalogFormat::Header))
+            {
+                STRTLR_CORE_LOG_ERROR("Catalog: '{}' is truncated", Filesystem::ToU8String(path));
+                Close();
+                return false;
+            }
+
+            // the mapping is page aligned and all sections are 8-byte aligned, so records are read in place
+            const auto& header = *reinterpret_cast<const CatalogFormat::Header*>(data);
+            if (std::memcmp(header.magic, CatalogFormat::Magic, sizeof(header.magic)) != 0 || header.version != CatalogFormat::Version)
+            {
+                STRTLR_CORE_LOG_ERROR("Catalog: '{}' is unsupported, version {}", Filesystem::ToU8String(path), header.version);
+                Close();
+                return false;
+            }
+
+            // counts are bounded by the remaining size before they are multiplied, so the offsets cannot wrap
+            const auto fits = [size](uint64_t offset, uint64_t count, uint64_t recordSize) {
+                return offset <= size && count <= (size - offset) / recordSize;
+            };
+            const auto translationsCount = uint64_t(header.messagesCount) * header.localesCount;
+
+            if (header.localesOffset != sizeof(CatalogFormat::Header)
+                || !fits(header.localesOffset, header.localesCount, sizeof(CatalogFormat::StringRef))
+                || header.seedsOffset != header.localesOffset + uint64_t(header.localesCount) * sizeof(CatalogFormat::StringRef)
+                || !fits(header.seedsOffset, header.bucketsCount, sizeof(uint32_t))
+                || header.messagesOffset != header.seedsOffset + AlignUp(uint64_t(header.bucketsCount) * sizeof(uint32_t))
+                || !fits(header.messagesOffset, header.messagesCount, sizeof(CatalogFormat::MessageRecord))
+                || header.translationsOffset != header.messagesOffset + uint64_t(header.messagesCount) * sizeof(CatalogFormat::MessageRecord)
+                || !fits(header.translationsOffset, translationsCount, sizeof(CatalogFormat::StringRef))
+                || header.stringsOffset != header.translationsOffset + translationsCount * sizeof(CatalogFormat::StringRef)
+                || header.stringsSize != size - header.stringsOffset
+                || (header.messagesCount != 0 && header.bucketsCount == 0))
+            {
+                STRTLR_CORE_LOG_ERROR("Catalog: '{}' sections are inconsistent", Filesystem::ToU8String(path));
+                Close();
+                return false;
+            }
+
+            _header = &header;
+            _locales = reinterpret_cast<const CatalogFormat::StringRef*>(data + header.localesOffset);
+            _seeds = reinterpret_cast<const uint32_t*>(data + header.seedsOffset);
+            _messages = reinterpret_cast<const CatalogFormat::MessageRecord*>(data + header.messagesOffset);
+            _translations = reinterpret_cast<const CatalogFormat::StringRef*>(data + header.translationsOffset);
+            _strings = reinterpret_cast<const char*>(data + header.stringsOffset);
+
+            STRTLR_CORE_LOG_INFO("Catalog: opened '{}', {} messages in {} locales", Filesystem::ToU8String(path), header.messagesCount, header.localesCount);
+            return true;
+        }
+        //--------------------------------------------------------------------------
+
+        void Catalog::Close()
+        {
+            _file.Close();
+            _header = nullptr;
+            _locales = nullptr;
+            _seeds = nullptr;
+            _messages = nullptr;
+            _translations = nullptr;
+            _strings = nullptr;
+        }
+        //--------------------------------------------------------------------------
+
+        bool Catalog::IsOpen() const
+        {
+            return _header != nullptr;
+        }
+        //--------------------------------------------------------------------------
+
+        bool Catalog::HasPlurals() const
+        {
+            return _header && (_header->flags & CatalogFormat::HasPluralsFlag);
+        }
+        //--------------------------------------------------------------------------
+
+        uint32_t Catalog::FindLocale(const LocaleStr& locale) const
+        {
+            if (!_header)
+            {
+                return InvalidLocale;
+            }
+
+            const auto name = std::string_view(locale).substr(0, locale.find('.'));
+            for (auto i = 0u; i < _header->localesCount; i++)
+            {
+                if (GetString(_locales[i]) == name)
+                {
+                    return i;
+                }
+            }
+
+            return InvalidLocale;
+        }
+        //--------------------------------------------------------------------------
+
+        std::string_view Catalog::Find(uint32_t locale, std::string_view source, std::string_view context) const
+        {
+            if (!_header || locale >= _header->localesCount || _header->messagesCount == 0)
+            {
+                return {};
+            }
+
+            const auto hash = CatalogFormat::HashMessage(source, context, _header->hashSalt);
+            const auto seed = _seeds[CatalogFormat::GetBucket(hash, _header->bucketsCount)];
+            const auto slot = CatalogFormat::GetSlot(hash, seed, _header->messagesCount);
+            if (slot >= _header->messagesCount)
+            {
+                return {};
+            }
+
+            // the perfect hash places every known message, anything else lands on a slot of another message
+            const auto& message = _messages[slot];
+            if (message.hash != hash || GetString(message.source) != source || GetString(message.context) != context)
+            {
+                return {};
+            }
+
+            return GetString(_translations[uint64_t(slot) * _header->localesCount + locale]);
+        }
+        //--------------------------------------------------------------------------
+
+        std::string_view Catalog::GetString(const CatalogFormat::StringRef& string) const
+        {
+            if (uint64_t(string.offset) + string.size > _header->stringsSize)
+            {
+                return {};
+            }
+
+            return std::string_view(_strings + string.offset, string.size);
+        }
+        //--------------------------------------------------------------------------
+
+        bool CatalogBuilder::AddPoFile(const LocaleStr& locale, const std::filesystem::path& path)
+        {
+            std::ifstream inputStream(path, std::ios::binary);
+            if (!inputStream.is_open() || !inputStream.good())
+            {
+                STRTLR_CORE_LOG_ERROR("CatalogBuilder: cannot open '{}'", Filesystem::ToU8String(path));
+                return false;
+            }
+
+            GetLocaleIndex(locale);
+
+            ContextStr context;
+            SourceStr source;
+            TranslationStr translation;
+            auto fuzzy = false;
+            auto plural = false;
+            auto translated = false;
+            // field continuation lines are appended to
+            std::string* field = nullptr;
+            auto messagesCount = 0;
+
+            const auto addEntry = [&]() {
+                if (plural)
+                {
+                    _hasPlurals = true;
+                }
+                // the header entry has an empty source, fuzzy ones are skipped as msgfmt does
+                else if (!source.empty() && !translation.empty() && !fuzzy)
+                {
+                    Add(locale, source, context, translation);
+                    ++messagesCount;
+                }
+
+                context.clear();
+                source.clear();
+                translation.clear();
+                fuzzy = false;
+                plural = false;
+                translated = false;
+                field = nullptr;
+            };
+
+            std::string line;
+            while (std::getline(inputStream, line))
+            {
+                const auto begin = line.find_first_not_of(" \t");
+                const auto end = line.find_last_not_of(" \t\r");
+                const auto trimmed = begin == std::string::npos ? std::string_view() : std::string_view(line).substr(begin, end - begin + 1);
+
+                // an entry ends with a blank line, a comment or the next entry's keyword
+                const auto startsEntry = trimmed.empty() || trimmed.starts_with('#') || trimmed.starts_with("msgctxt") || (trimmed.starts_with("msgid") && !trimmed.starts_with("msgid_plural"));
+                if (startsEntry && translated)
+                {
+                    addEntry();
+                }
+
+                if (trimmed.starts_with("#,"))
+                {
+                    fuzzy = trimmed.find("fuzzy") != std::string_view::npos;
+                }
+                else if (trimmed.starts_with("msgctxt"))
+                {
+                    context = UnquotePoString(trimmed);
+                    field = &context;
+                }
+                else if (trimmed.starts_with("msgid_plural"))
+                {
+                    plural = true;
+                    field = nullptr;
+                }
+                else if (trimmed.starts_with("msgid"))
+                {
+                    source = UnquotePoString(trimmed);
+                    field = &source;
+                }
+                else if (trimmed.starts_with("msgstr["))
+                {
+                    translated = true;
+                    field = nullptr;
+                }
+                else if (trimmed.starts_with("msgstr"))
+                {
+                    translation = UnquotePoString(trimmed);
+                    translated = true;
+                    field = &translation;
+                }
+                else if (trimmed.starts_with('"') && field)
+                {
+                    field->append(UnquotePoString(trimmed));
+                }
+            }
+
+            if (translated)
+            {
+                addEntry();
+            }
+
+            STRTLR_CORE_LOG_INFO("CatalogBuilder: added {} messages of '{}' from '{}'", messagesCount, locale, Filesystem::ToU8String(path));
+            return true;
+        }
+        //--------------------------------------------------------------------------
+
+        void CatalogBuilder::Add(const LocaleStr& locale, const SourceStr& source, const ContextStr& context, const TranslationStr& translation)
+        {
+            const auto localeIndex = GetLocaleIndex(locale);
+
+            auto it = _messagesIndex.find(ContextedSourceView{ source, context });
+            if (it == _messagesIndex.cend())
+            {
+                it = _messagesIndex.emplace(ContextedSource{ source, context }, _messages.size()).first;
+                _messages.push_back({ source, context, {} });
+            }
+
+            auto& translations = _messages[it->second].translations;
+            if (translations.size() <= localeIndex)
+            {
+                translations.resize(localeIndex + 1);
+            }
+
+            translations[localeIndex] = translation;
+        }
+        //--------------------------------------------------------------------------
+
+        bool CatalogBuilder::Write(const std::filesystem::path& path) const
+        {
+            STRTLR_CORE_LOG_INFO("CatalogBuilder: writing '{}', {} messages in {} locales", Filesystem::ToU8String(path), _messages.size(), _locales.size());
+
+            const auto messagesCount = uint32_t(_messages.size());
+            const auto localesCount = uint32_t(_locales.size());
+            const auto bucketsCount = std::max(1u, (messagesCount + 3) / 4);
+
+            std::vector<uint64_t> hashes(messagesCount);
+            std::vector<uint32_t> seeds;
+            std::vector<uint32_t> slots;
+            auto hashSalt = 0u;
+            for (; hashSalt < MaxHashSalt; hashSalt++)
+            {
+                for (auto i = 0u; i < messagesCount; i++)
+                {
+                    hashes[i] = CatalogFormat::HashMessage(_messages[i].source, _messages[i].context, hashSalt);
+                }
+
+                if (PlaceMessages(hashes, bucketsCount, seeds, slots))
+                {
+                    break;
+                }
+            }
+
+            if (hashSalt == MaxHashSalt)
+            {
+                STRTLR_CORE_LOG_ERROR("CatalogBuilder: cannot build a perfect hash for '{}'", Filesystem::ToU8String(path));
+                return false;
+            }
+
+            std::string strings;
+            const auto addString = [&strings](std::string_view string) {
+                const auto ref = CatalogFormat::StringRef{ uint32_t(strings.size()), uint32_t(string.size()) };
+                strings.append(string);
+                return ref;
+            };
+
+            std::vector<CatalogFormat::StringRef> locales;
+            locales.reserve(localesCount);
+            for (const auto& locale : _locales)
+            {
+                locales.push_back(addString(locale));
+            }
+
+            std::vector<CatalogFormat::MessageRecord> messages(messagesCount);
+            std::vector<CatalogFormat::StringRef> translations(uint64_t(messagesCount) * localesCount, CatalogFormat::StringRef{ 0, 0 });
+            for (auto slot = 0u; slot < messagesCount; slot++)
+            {
+                const auto& message = _messages[slots[slot]];
+                messages[slot] = { hashes[slots[slot]], addString(message.source), addString(message.context) };
+
+                for (auto locale = 0u; locale < message.translations.size(); locale++)
+                {
+                    translations[uint64_t(slot) * localesCount + locale] = addString(message.translations[locale]);
+                }
+            }
+
+            if (strings.size() > std::numeric_limits<uint32_t>::max())
+            {
+                STRTLR_CORE_LOG_ERROR("CatalogBuilder: strings of '{}' exceed 4 GB", Filesystem::ToU8String(path));
+                return false;
+            }
+
+            CatalogFormat::Header header{};
+            std::memcpy(header.magic, CatalogFormat::Magic, sizeof(header.magic));
+            header.version = CatalogFormat::Version;
+            header.flags = _hasPlurals ? CatalogFormat::HasPluralsFlag : 0;
+            header.hashSalt = hashSalt;
+            header.localesCount = localesCount;
+            header.messagesCount = messagesCount;
+            header.bucketsCount = bucketsCount;
+            header.localesOffset = sizeof(CatalogFormat::Header);
+            header.seedsOffset = header.localesOffset + locales.size() * sizeof(CatalogFormat::StringRef);
+            header.messagesOffset = header.seedsOffset + AlignUp(seeds.size() * sizeof(uint32_t));
+            header.translationsOffset = header.messagesOffset + messages.size() * sizeof(CatalogFormat::MessageRecord);
+            header.stringsOffset = header.translationsOffset + translations.size() * sizeof(CatalogFormat::StringRef);
+            header.stringsSize = strings.size();
+
+            std::ofstream outputStream(path, std::ios::binary | std::ios::trunc);
+            if (!outputStream.is_open() || !outputStream.good())
+            {
+                STRTLR_CORE_LOG_ERROR("CatalogBuilder: cannot open '{}' for writing", Filesystem::ToU8String(path));
+                return false;
+            }
+
+            const char padding[8] = {};
+            outputStream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            outputStream.write(reinterpret_cast<const char*>(locales.data()), locales.size() * sizeof(CatalogFormat::StringRef));
+            outputStream.write(reinterpret_cast<const char*>(seeds.data()), seeds.size() * sizeof(uint32_t));
+            outputStream.write(padding, header.messagesOffset - header.seedsOffset - seeds.size() * sizeof(uint32_t));
+            outputStream.write(reinterpret_cast<const char*>(messages.data()), messages.size() * sizeof(CatalogFormat::MessageRecord));
+            outputStream.write(reinterpret_cast<const char*>(translations.data()), translations.size() * sizeof(CatalogFormat::StringRef));
+            outputStream.write(strings.data(), strings.size());
+
+            outputStream.close();
+            return !outputStream.fail();
+        }
+        //--------------------------------------------------------------------------
+
+        std::size_t CatalogBuilder::GetLocaleIndex(const LocaleStr& locale)
+        {
+            const auto it = std::find(_locales.cbegin(), _locales.cend(), locale);
+            if (it != _locales.cend())
+            {
+                return std::size_t(it - _locales.cbegin());
+            }
+
+            _locales.push_back(locale);
+            return _locales.size() - 1;
+        }
+        //--------------------------------------------------------------------------
+    }
+}
\ No newline at end of file
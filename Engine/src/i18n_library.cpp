@@ -68,22 +68,24 @@ namespace Storyteller
         }
         //--------------------------------------------------------------------------
 
-        const TranslationStr& Library::Get(const DomainStr& domain, const SourceStr& source)
+        const TranslationStr& Library::Get(std::string_view domain, std::string_view source) const
         {
-            if (_lookupDictionaries.contains(domain))
+            const auto it = _lookupDictionaries.find(domain);
+            if (it != _lookupDictionaries.cend())
             {
-                return _lookupDictionaries.at(domain)->Get(source);
+                return it->second->Get(source);
             }
 
             return noTranslation;
         }
         //--------------------------------------------------------------------------
 
-        const TranslationStr& Library::Get(const DomainStr& domain, const SourceStr& source, const ContextStr& context)
+        const TranslationStr& Library::Get(std::string_view domain, std::string_view source, std::string_view context) const
         {
-            if (_lookupDictionaries.contains(domain))
+            const auto it = _lookupDictionaries.find(domain);
+            if (it != _lookupDictionaries.cend())
             {
-                return _lookupDictionaries.at(domain)->Get(source, context);
+                return it->second->Get(source, context);
             }
 
             return noTranslation;
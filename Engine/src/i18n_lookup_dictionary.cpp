@@ -4,9 +4,16 @@ namespace Storyteller
 {
     namespace I18N
     {
+        static const TranslationStr noTranslation = TranslationStr("");
+
         LookupDictionary::LookupDictionary(const DomainStr& domain, const LocaleStr& defaultLocale)
             : _domain(domain)
             , _currentLocaleString(defaultLocale)
+            , _currentTranslations(&_translations[defaultLocale])
+            , _currentTranslationsWithContext(&_translationsWithContext[defaultLocale])
+            , _currentMessages(&_localizedMessages[defaultLocale])
+            , _catalog(nullptr)
+            , _catalogLocale(Catalog::InvalidLocale)
         {}
         //--------------------------------------------------------------------------
 
@@ -19,30 +26,98 @@ namespace Storyteller
         void LookupDictionary::SetLocale(const LocaleStr& locale)
         {
             _currentLocaleString = locale;
+            _currentTranslations = &_translations[locale];
+            _currentTranslationsWithContext = &_translationsWithContext[locale];
+            _currentMessages = &_localizedMessages[locale];
+            _catalogLocale = _catalog ? _catalog->FindLocale(locale) : Catalog::InvalidLocale;
+
+            // messages registered while another locale was set
+            for (auto id = _currentMessages->size(); id < _messageSources.size(); id++)
+            {
+                _currentMessages->push_back(&Get(*_messageSources[id]));
+            }
         }
         //--------------------------------------------------------------------------
 
         void LookupDictionary::Add(const SourceStr& source, const TranslationStr& translation)
         {
-            _translations[_currentLocaleString].insert(std::make_pair(source, translation));
+            const auto [it, inserted] = _currentTranslations->emplace(source, translation);
+            if (inserted && !_messageIds.empty())
+            {
+                const auto idIt = _messageIds.find(source);
+                if (idIt != _messageIds.cend())
+                {
+                    (*_currentMessages)[idIt->second] = &it->second;
+                }
+            }
         }
         //--------------------------------------------------------------------------
 
         void LookupDictionary::Add(const SourceStr& source, const ContextStr& context, const TranslationStr& translation)
         {
-            _translationsWithContext[_currentLocaleString].insert(std::make_pair(ContextedSource{ source, context }, translation));
+            _currentTranslationsWithContext->emplace(ContextedSource{ source, context }, translation);
+        }
+        //--------------------------------------------------------------------------
+
+        const TranslationStr& LookupDictionary::Get(std::string_view source) const
+        {
+            const auto it = _currentTranslations->find(source);
+            return it != _currentTranslations->cend() ? it->second : noTranslation;
+        }
+        //--------------------------------------------------------------------------
+
+        const TranslationStr& LookupDictionary::Get(std::string_view source, std::string_view context) const
+        {
+            const auto it = _currentTranslationsWithContext->find(ContextedSourceView{ source, context });
+            return it != _currentTranslationsWithContext->cend() ? it->second : noTranslation;
+        }
+        //--------------------------------------------------------------------------
+
+        MessageId LookupDictionary::Register(std::string_view source)
+        {
+            const auto idIt = _messageIds.find(source);
+            if (idIt != _messageIds.cend())
+            {
+                return idIt->second;
+            }
+
+            const auto id = MessageId(_messageSources.size());
+            const auto it = _messageIds.emplace(SourceStr(source), id).first;
+            _messageSources.push_back(&it->first);
+            _currentMessages->push_back(&Get(source));
+
+            return id;
+        }
+        //--------------------------------------------------------------------------
+
+        const TranslationStr& LookupDictionary::Get(MessageId id) const
+        {
+            return *(*_currentMessages)[id];
+        }
+        //--------------------------------------------------------------------------
+        void LookupDictionary::SetCatalog(const Ptr<Catalog>& catalog)
+        {
+            _catalog = catalog;
+            _catalogLocale = _catalog ? _catalog->FindLocale(_currentLocaleString) : Catalog::InvalidLocale;
+        }
+        //--------------------------------------------------------------------------
+
+        bool LookupDictionary::HasCatalog() const
+        {
+            return _catalog != nullptr;
         }
         //--------------------------------------------------------------------------
 
-        const TranslationStr& LookupDictionary::Get(const SourceStr& source)
+        TranslationStr LookupDictionary::TranslateFromCatalog(std::string_view source) const
         {
-            return _translations[_currentLocaleString][source];
+            return TranslateFromCatalog(source, std::string_view());
         }
         //--------------------------------------------------------------------------
 
-        const TranslationStr& LookupDictionary::Get(const SourceStr& source, const ContextStr& context)
+        TranslationStr LookupDictionary::TranslateFromCatalog(std::string_view source, std::string_view context) const
         {
-            return _translationsWithContext[_currentLocaleString][{source, context}];
+            const auto translation = _catalog ? _catalog->Find(_catalogLocale, source, context) : std::string_view();
+            return TranslationStr(translation.empty() ? source : translation);
         }
         //--------------------------------------------------------------------------
     }
@@ -1,5 +1,6 @@
 #include "i18n_manager.h"
 #include "i18n_library.h"
+#include "i18n_catalog_format.h"
 #include "log.h"
 
 #include <iostream>
@@ -15,6 +16,9 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("I18NManager: create, default path '{}'", defaultPath);
 
+            // switching back to a locale imbues the generated one again instead of parsing its .mo files once more
+            _localeGenerator.locale_cache_enabled(true);
+
             if (!defaultLocale.empty())
             {
                 SetLocale(defaultLocale);
@@ -23,6 +27,16 @@ namespace Storyteller
             if (!defaultPath.empty())
             {
                 _localeGenerator.add_messages_path(defaultPath);
+                _messagesPaths.push_back(defaultPath);
+            }
+        }
+        //--------------------------------------------------------------------------
+
+        Manager::~Manager()
+        {
+            if (_prefetched.valid())
+            {
+                _prefetched.wait();
             }
         }
         //--------------------------------------------------------------------------
@@ -31,6 +45,8 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("I18NManager: set locale '{}'", localeString);
 
+            FinishPrefetch();
+
             _currentLocale = localeString;
             _library->SetLocale(localeString);
 
@@ -57,6 +73,8 @@ namespace Storyteller
             STRTLR_CORE_LOG_INFO("I18NManager: add messages path '{}'", path);
 
             _localeGenerator.add_messages_path(path);
+            _localeGenerator.clear_cache();
+            _messagesPaths.push_back(path);
         }
         //--------------------------------------------------------------------------
 
@@ -64,15 +82,28 @@ namespace Storyteller
         {
             STRTLR_CORE_LOG_INFO("I18NManager: add messages domain '{}'", domain);
 
-            _localeGenerator.add_messages_domain(domain);
-            ImbueLocale();
+            FinishPrefetch();
 
-            return _library->AddLookupDictionary(domain);
+            const auto dictionary = _library->AddLookupDictionary(domain);
+            const auto catalog = LoadCatalog(domain);
+            dictionary->SetCatalog(catalog);
+
+            // regenerating the locale parses all .mo files of the domains, a catalog without plurals makes it unnecessary
+            if (!catalog || catalog->HasPlurals())
+            {
+                _localeGenerator.add_messages_domain(domain);
+                _localeGenerator.clear_cache();
+                ImbueLocale();
+            }
+
+            return dictionary;
         }
         //--------------------------------------------------------------------------
 
         void Manager::RemoveMessagesDomain(const DomainStr& domain)
         {
+            FinishPrefetch();
+
             _library->RemoveLookupDictionary(domain);
         }
         //--------------------------------------------------------------------------
@@ -98,9 +129,31 @@ namespace Storyteller
         }
         //--------------------------------------------------------------------------
 
+        Ptr<Catalog> Manager::LoadCatalog(const DomainStr& domain) const
+        {
+            // same precedence as the generator, the first path having the domain is used
+            for (const auto& path : _messagesPaths)
+            {
+                const auto catalogPath = std::filesystem::path(path) / (domain + STRTLR_TRANSLATION_CATALOG_EXTENSION);
+                if (!Filesystem::PathExists(catalogPath))
+                {
+                    continue;
+                }
+
+                const auto catalog = CreatePtr<Catalog>();
+                if (catalog->Open(catalogPath))
+                {
+                    return catalog;
+                }
+            }
+
+            return nullptr;
+        }
+        //--------------------------------------------------------------------------
+
         TranslationStr Manager::Translate(const DomainStr& domain, const SourceStr& message)
         {
-            const auto translation = Translator::Translate(domain, message);
+            const auto translation = Lookup(_library->GetLookupDictionary(domain).get(), domain, message);
             _library->Add(domain, message, translation);
             return translation;
         }
@@ -114,7 +167,8 @@ namespace Storyteller
 
         TranslationStr Manager::TranslateCtx(const DomainStr& domain, const SourceStr& message, const ContextStr& context)
         {
-            const auto translation = Translator::TranslateCtx(domain, message, context);
+            const auto dictionary = _library->GetLookupDictionary(domain);
+            const auto translation = dictionary && dictionary->HasCatalog() ? dictionary->TranslateFromCatalog(message, context) : Translator::TranslateCtx(domain, message, context);
             _library->Add(domain, message, context, translation);
             return translation;
         }
@@ -126,6 +180,15 @@ namespace Storyteller
         }
         //--------------------------------------------------------------------------
 
+        MessageId Manager::TranslateHandle(const DomainStr& domain, const SourceStr& message)
+        {
+            Translate(domain, message);
+
+            const auto dictionary = _library->GetLookupDictionary(domain);
+            return dictionary ? dictionary->Register(message) : InvalidMessageId;
+        }
+        //--------------------------------------------------------------------------
+
         const TranslationStr& Manager::Translation(const DomainStr& domain, const SourceStr& message)
         {
             return _library->Get(domain, message);
@@ -165,5 +228,88 @@ namespace Storyteller
             return translation.empty() ? message : translation;
         }
         //--------------------------------------------------------------------------
+
+        const TranslationStr& Manager::TranslationLazy(const DomainStr& domain, const SourceStr& message)
+        {
+            if (_prefetched.valid() && _prefetched.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                FinishPrefetch();
+            }
+
+            const auto dictionary = _library->GetLookupDictionary(domain);
+            if (!dictionary)
+            {
+                return _library->Get(domain, message);
+            }
+
+            const auto& translation = dictionary->Get(message);
+            if (!translation.empty() || message.empty())
+            {
+                return translation;
+            }
+
+            dictionary->Add(message, Lookup(dictionary.get(), domain, message));
+            return dictionary->Get(message);
+        }
+        //--------------------------------------------------------------------------
+
+        void Manager::Prefetch(const DomainStr& domain, std::vector<SourceStr> messages)
+        {
+            FinishPrefetch();
+
+            const auto dictionary = _library->GetLookupDictionary(domain);
+            if (!dictionary)
+            {
+                return;
+            }
+
+            std::erase_if(messages, [&dictionary](const SourceStr& message) { return message.empty() || !dictionary->Get(message).empty(); });
+            if (messages.empty())
+            {
+                return;
+            }
+
+            // the worker only reads the catalog or the global locale, both stay unchanged until FinishPrefetch
+            _prefetched = std::async(std::launch::async, [dictionary, domain, messages = std::move(messages)]() mutable {
+                Prefetched prefetched{ domain, {} };
+                prefetched.translations.reserve(messages.size());
+                for (auto& message : messages)
+                {
+                    auto translation = Lookup(dictionary.get(), domain, message);
+                    prefetched.translations.emplace_back(std::move(message), std::move(translation));
+                }
+
+                return prefetched;
+                }
+            );
+        }
+        //--------------------------------------------------------------------------
+
+        void Manager::FinishPrefetch()
+        {
+            if (!_prefetched.valid())
+            {
+                return;
+            }
+
+            const auto prefetched = _prefetched.get();
+            const auto dictionary = _library->GetLookupDictionary(prefetched.domain);
+            if (!dictionary)
+            {
+                return;
+            }
+
+            for (const auto& [source, translation] : prefetched.translations)
+            {
+                dictionary->Add(source, translation);
+            }
+        }
+        //--------------------------------------------------------------------------
+
+        TranslationStr Manager::Lookup(const LookupDictionary* dictionary, const DomainStr& domain, const SourceStr& message)
+        {
+            return dictionary && dictionary->HasCatalog() ? dictionary->TranslateFromCatalog(message) : Translator::Translate(domain, message);
+        }
+        //--------------------------------------------------------------------------
     }
 }
\ No newline at end of file
@@ -1,12 +1,9 @@
 #include "json_reader.h"
 #include "log.h"
 
-#include <rapidjson/pointer.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/error/en.h>
 
-#include <algorithm>
-#include <numeric>
 #include <fstream>
 
 namespace Storyteller
@@ -15,7 +12,6 @@ namespace Storyteller
         : _path(path)
         , _document()
         , _scope()
-        , _scopeString("")
         , _currentObject(nullptr)
     {}
     //--------------------------------------------------------------------------
@@ -46,7 +42,8 @@ namespace Storyteller
             return false;
         }
 
-        _currentObject = rapidjson::Pointer("").Get(_document);
+        _scope.clear();
+        _currentObject = &_document;
 
         return true;
     }
@@ -65,15 +62,15 @@ namespace Storyteller
             return false;
         }
 
-        if (!(*_currentObject)[index].IsObject())
+        auto& arrayObject = (*_currentObject)[index];
+        if (!arrayObject.IsObject())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an array object", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an array object", GetCurrentScopeString(), index);
             return false;
         }
 
-        _scope.push_back(std::to_string(index));
-        _scopeString = GetCurrentScopeString();
-        _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
+        _scope.push_back({ _currentObject, nullptr, index });
+        _currentObject = &arrayObject;
 
         return true;
     }
@@ -83,9 +80,8 @@ namespace Storyteller
     {
         if (!_scope.empty())
         {
+            _currentObject = _scope.back().parent;
             _scope.pop_back();
-            _scopeString = GetCurrentScopeString();
-            _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
 
             return true;
         }
@@ -108,22 +104,15 @@ namespace Storyteller
             return false;
         }
 
-        _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
-        if (!_currentObject)
-        {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot fetch object pointer for '{}'", _scopeString);
-            return false;
-        }
-
-        if (!_currentObject->HasMember(groupName.c_str()) || !(*_currentObject)[groupName.c_str()].IsObject())
+        const auto member = _currentObject->FindMember(groupName.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsObject())
         {
             STRTLR_CORE_LOG_ERROR("JsonReader: cannot find member '{}', or the member is not an object type", groupName);
             return false;
         }
 
-        _scope.push_back(groupName);
-        _scopeString = GetCurrentScopeString();
-        _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
+        _scope.push_back({ _currentObject, member->name.GetString(), -1 });
+        _currentObject = &member->value;
 
         return true;
     }
@@ -133,9 +122,8 @@ namespace Storyteller
     {
         if (!_scope.empty())
         {
+            _currentObject = _scope.back().parent;
             _scope.pop_back();
-            _scopeString = GetCurrentScopeString();
-            _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
 
             return true;
         }
@@ -158,24 +146,17 @@ namespace Storyteller
             return 0;
         }
 
-        _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
-        if (!_currentObject)
-        {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot fetch object pointer for '{}'", _scopeString);
-            return 0;
-        }
-
-        if (!_currentObject->HasMember(arrayName.c_str()) || !(*_currentObject)[arrayName.c_str()].IsArray())
+        const auto member = _currentObject->FindMember(arrayName.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsArray())
         {
             STRTLR_CORE_LOG_ERROR("JsonReader: cannot find member '{}', or the member is not an array type", arrayName);
             return 0;
         }
 
-        _scope.push_back(arrayName);
-        _scopeString = GetCurrentScopeString();
-        _currentObject = rapidjson::Pointer(_scopeString.c_str()).Get(_document);
+        _scope.push_back({ _currentObject, member->name.GetString(), -1 });
+        _currentObject = &member->value;
 
-        return (*_currentObject).GetArray().Size();
+        return _currentObject->Size();
     }
     //--------------------------------------------------------------------------
 
@@ -194,7 +175,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsBool())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a bool", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a bool", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -209,13 +190,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsBool())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsBool())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find bool for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find bool for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetBool();
+        return member->value.GetBool();
     }
     //--------------------------------------------------------------------------
 
@@ -228,7 +210,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsInt())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an int", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an int", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -243,13 +225,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsInt())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsInt())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find int for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find int for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetInt();
+        return member->value.GetInt();
     }
     //--------------------------------------------------------------------------
 
@@ -262,7 +245,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsUint())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an uint", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an uint", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -277,13 +260,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsUint())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsUint())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find uint for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find uint for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetUint();
+        return member->value.GetUint();
     }
     //--------------------------------------------------------------------------
 
@@ -296,7 +280,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsInt64())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an int64", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an int64", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -311,13 +295,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsInt64())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsInt64())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find int64 for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find int64 for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetInt64();
+        return member->value.GetInt64();
     }
     //--------------------------------------------------------------------------
 
@@ -330,7 +315,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsUint64())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an uint64", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not an uint64", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -345,13 +330,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsUint64())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsUint64())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find uint64 for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find uint64 for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetUint64();
+        return member->value.GetUint64();
     }
     //--------------------------------------------------------------------------
 
@@ -364,7 +350,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsDouble())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a double", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a double", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -379,13 +365,14 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsDouble())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsDouble())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find double for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find double for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetDouble();
+        return member->value.GetDouble();
     }
     //--------------------------------------------------------------------------
 
@@ -398,7 +385,7 @@ namespace Storyteller
 
         if (!(*_currentObject)[index].IsString())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a string", _scopeString, index);
+            STRTLR_CORE_LOG_ERROR("JsonReader: '{}[{}]' is not a string", GetCurrentScopeString(), index);
             return defaultValue;
         }
 
@@ -413,24 +400,27 @@ namespace Storyteller
             return defaultValue;
         }
 
-        if (!_currentObject->HasMember(name.c_str()) || !(*_currentObject)[name.c_str()].IsString())
+        const auto member = _currentObject->FindMember(name.c_str());
+        if (member == _currentObject->MemberEnd() || !member->value.IsString())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find string for '{}/{}'", _scopeString, name);
+            STRTLR_CORE_LOG_ERROR("JsonReader: cannot find string for '{}/{}'", GetCurrentScopeString(), name);
             return defaultValue;
         }
 
-        return (*_currentObject)[name.c_str()].GetString();
+        return member->value.GetString();
     }
     //--------------------------------------------------------------------------
 
     std::string JsonReader::GetCurrentScopeString() const
     {
-        return _scope.empty()
-            ? ""
-            : std::accumulate(_scope.begin(), _scope.end(), std::string(),
-                [](const std::string& a, const std::string& b) {
-                    return a + '/' + b;
-                });
+        // only used for diagnostics, navigation itself goes through the scope cursors
+        std::string scopeString;
+        for (const auto& entry : _scope)
+        {
+            scopeString.append("/").append(entry.name ? entry.name : std::to_string(entry.index));
+        }
+
+        return scopeString;
     }
     //--------------------------------------------------------------------------
 
@@ -443,13 +433,13 @@ namespace Storyteller
 
         if (!_currentObject->IsArray())
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: current object '{}' is not an array", _scopeString);
+            STRTLR_CORE_LOG_ERROR("JsonReader: current object '{}' is not an array", GetCurrentScopeString());
             return false;
         }
 
         if (index >= _currentObject->Size() || index < 0)
         {
-            STRTLR_CORE_LOG_ERROR("JsonReader: invalid index [{}] for '{}'", index, _scopeString);
+            STRTLR_CORE_LOG_ERROR("JsonReader: invalid index [{}] for '{}'", index, GetCurrentScopeString());
             return false;
         }
 
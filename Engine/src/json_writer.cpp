@@ -1,17 +1,28 @@
 #include "json_writer.h"
 #include "log.h"
 
-#include <fstream>
-
 namespace Storyteller
 {
     JsonWriter::JsonWriter(const std::filesystem::path& path)
         : _path(path)
-        , _stringBuffer()
-        , _writer(_stringBuffer)
+        , _temporaryPath(std::filesystem::path(path).concat(".tmp"))
+        , _outputBuffer(OutputBufferSize)
+        , _outputStream()
+        , _streamWrapper(_outputStream)
+        , _writer(_streamWrapper)
     {}
     //--------------------------------------------------------------------------
 
+    JsonWriter::~JsonWriter()
+    {
+        if (_outputStream.is_open())
+        {
+            STRTLR_CORE_LOG_WARN("JsonWriter: saving to '{}' was not finished", Filesystem::ToU8String(_path));
+            DiscardOutput();
+        }
+    }
+    //--------------------------------------------------------------------------
+
     bool JsonWriter::Start()
     {
         STRTLR_CORE_LOG_INFO("JsonWriter: saving to '{}'", Filesystem::ToU8String(_path));
@@ -22,23 +33,51 @@ namespace Storyteller
             return false;
         }
 
+        // the document is streamed into a temporary file which replaces the target only when complete
+        if (_outputStream.is_open())
+        {
+            DiscardOutput();
+        }
+
+        _outputStream.rdbuf()->pubsetbuf(_outputBuffer.data(), _outputBuffer.size());
+        _outputStream.open(_temporaryPath, std::ios::out | std::ios::trunc);
+        if (!_outputStream.is_open() || !_outputStream.good())
+        {
+            STRTLR_CORE_LOG_WARN("JsonWriter: failed to open file stream");
+            return false;
+        }
+
+        _writer.Reset(_streamWrapper);
+
         return _writer.StartObject();
     }
     //--------------------------------------------------------------------------
 
     bool JsonWriter::End()
     {
+        if (!_outputStream.is_open())
+        {
+            STRTLR_CORE_LOG_WARN("JsonWriter: saving was not started");
+            return false;
+        }
+
         _writer.EndObject();
+        _outputStream.close();
 
-        std::ofstream outputStream(_path, std::ios::out | std::ios::trunc);
-        if (!outputStream.is_open() || !outputStream.good())
+        if (_outputStream.fail() || !_writer.IsComplete())
         {
-            STRTLR_CORE_LOG_WARN("JsonWriter: failed to open file stream");
+            STRTLR_CORE_LOG_WARN("JsonWriter: failed to write '{}'", Filesystem::ToU8String(_temporaryPath));
+            DiscardOutput();
             return false;
         }
 
-        outputStream << _stringBuffer.GetString();
-        outputStream.close();
+        std::error_code error;
+        if (!Filesystem::DurableRename(_temporaryPath, _path, error))
+        {
+            STRTLR_CORE_LOG_WARN("JsonWriter: failed to replace '{}', {}", Filesystem::ToU8String(_path), error.message());
+            DiscardOutput();
+            return false;
+        }
 
         return true;
     }
@@ -223,4 +262,18 @@ namespace Storyteller
         return false;
     }
     //--------------------------------------------------------------------------
+
+    void JsonWriter::DiscardOutput()
+    {
+        if (_outputStream.is_open())
+        {
+            _outputStream.close();
+        }
+
+        _outputStream.clear();
+
+        std::error_code error;
+        std::filesystem::remove(_temporaryPath, error);
+    }
+    //--------------------------------------------------------------------------
 }
\ No newline at end of file
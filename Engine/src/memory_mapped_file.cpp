@@ -0,0 +1,141 @@
+#include "memory_mapped_file.h"
+#include "filesystem.h"
+#include "log.h"
+
+#if !defined STRTLR_PLATFORM_WINDOWS
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Storyteller
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+    //--------------------------------------------------------------------------
+
+    bool MemoryMappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+#if defined STRTLR_PLATFORM_WINDOWS
+        _fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            _fileHandle = nullptr;
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: cannot open '{}'", Filesystem::ToU8String(path));
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: '{}' is empty or its size is unavailable", Filesystem::ToU8String(path));
+            Close();
+            return false;
+        }
+
+        _mappingHandle = CreateFileMappingW(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!_mappingHandle)
+        {
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: cannot create mapping for '{}'", Filesystem::ToU8String(path));
+            Close();
+            return false;
+        }
+
+        _data = static_cast<const std::byte*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        _size = std::size_t(fileSize.QuadPart);
+#else
+        _fileDescriptor = open(path.c_str(), O_RDONLY);
+        if (_fileDescriptor < 0)
+        {
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: cannot open '{}'", Filesystem::ToU8String(path));
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(_fileDescriptor, &fileStat) < 0 || fileStat.st_size == 0)
+        {
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: '{}' is empty or its size is unavailable", Filesystem::ToU8String(path));
+            Close();
+            return false;
+        }
+
+        auto mapping = mmap(nullptr, std::size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+        if (mapping != MAP_FAILED)
+        {
+            _data = static_cast<const std::byte*>(mapping);
+            _size = std::size_t(fileStat.st_size);
+            madvise(mapping, _size, MADV_SEQUENTIAL);
+        }
+#endif
+
+        if (!_data)
+        {
+            STRTLR_CORE_LOG_ERROR("MemoryMappedFile: cannot map '{}'", Filesystem::ToU8String(path));
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    void MemoryMappedFile::Close()
+    {
+#if defined STRTLR_PLATFORM_WINDOWS
+        if (_data)
+        {
+            UnmapViewOfFile(_data);
+        }
+
+        if (_mappingHandle)
+        {
+            CloseHandle(_mappingHandle);
+            _mappingHandle = nullptr;
+        }
+
+        if (_fileHandle)
+        {
+            CloseHandle(_fileHandle);
+            _fileHandle = nullptr;
+        }
+#else
+        if (_data)
+        {
+            munmap(const_cast<std::byte*>(_data), _size);
+        }
+
+        if (_fileDescriptor >= 0)
+        {
+            close(_fileDescriptor);
+            _fileDescriptor = -1;
+        }
+#endif
+
+        _data = nullptr;
+        _size = 0;
+    }
+    //--------------------------------------------------------------------------
+
+    bool MemoryMappedFile::IsOpen() const
+    {
+        return _data != nullptr;
+    }
+    //--------------------------------------------------------------------------
+
+    const std::byte* MemoryMappedFile::GetData() const
+    {
+        return _data;
+    }
+    //--------------------------------------------------------------------------
+
+    std::size_t MemoryMappedFile::GetSize() const
+    {
+        return _size;
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -4,6 +4,13 @@ namespace Storyteller
 {
     ProgramOptions::ProgramOptions()
         : _configPath("")
+        , _headless(false)
+        , _explore(false)
+        , _choicesPath("")
+        , _playthroughsCount(0)
+        , _seed(0)
+        , _maxSteps(10000)
+        , _threadsCount(0)
     {}
     //--------------------------------------------------------------------------
 
@@ -27,6 +34,48 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
+    bool ProgramOptions::IsHeadless() const
+    {
+        return _headless;
+    }
+    //--------------------------------------------------------------------------
+
+    bool ProgramOptions::IsExplore() const
+    {
+        return _explore;
+    }
+    //--------------------------------------------------------------------------
+
+    const std::string& ProgramOptions::GetChoicesPath() const
+    {
+        return _choicesPath;
+    }
+    //--------------------------------------------------------------------------
+
+    unsigned int ProgramOptions::GetPlaythroughsCount() const
+    {
+        return _playthroughsCount;
+    }
+    //--------------------------------------------------------------------------
+
+    uint64_t ProgramOptions::GetSeed() const
+    {
+        return _seed;
+    }
+    //--------------------------------------------------------------------------
+
+    unsigned int ProgramOptions::GetMaxSteps() const
+    {
+        return _maxSteps;
+    }
+    //--------------------------------------------------------------------------
+
+    unsigned int ProgramOptions::GetThreadsCount() const
+    {
+        return _threadsCount;
+    }
+    //--------------------------------------------------------------------------
+
     boost::program_options::command_line_parser ProgramOptions::CreateCmdParser(char* lpCmdLine) const
     {
         const auto args = boost::program_options::split_winmain(lpCmdLine);
@@ -45,6 +94,13 @@ namespace Storyteller
         boost::program_options::options_description optDescription("Storyteller options");
         optDescription.add_options()
             ("config,C", boost::program_options::value<std::string>(), "Path to configuration file")
+            ("headless", "Play the game without console rendering and report throughput")
+            ("choices", boost::program_options::value<std::string>(), "Path to a file of scripted choices for headless playthroughs, one playthrough per line")
+            ("playthroughs", boost::program_options::value<unsigned int>(), "Number of headless or exploration playthroughs")
+            ("seed", boost::program_options::value<uint64_t>(), "Seed of the random choice policy for headless playthroughs")
+            ("max-steps", boost::program_options::value<unsigned int>(), "Steps limit of a single headless playthrough")
+            ("explore", "Play random games on all cores and report story statistics")
+            ("threads", boost::program_options::value<unsigned int>(), "Number of exploration threads, all cores by default")
         ;
 
         boost::program_options::variables_map vm;
@@ -52,6 +108,13 @@ namespace Storyteller
         boost::program_options::notify(vm);
 
         _configPath = vm.count("config") ? vm["config"].as<std::string>() : "";
+        _headless = vm.count("headless") > 0;
+        _choicesPath = vm.count("choices") ? vm["choices"].as<std::string>() : "";
+        _playthroughsCount = vm.count("playthroughs") ? vm["playthroughs"].as<unsigned int>() : 0;
+        _seed = vm.count("seed") ? vm["seed"].as<uint64_t>() : 0;
+        _maxSteps = vm.count("max-steps") ? vm["max-steps"].as<unsigned int>() : 10000;
+        _explore = vm.count("explore") > 0;
+        _threadsCount = vm.count("threads") ? vm["threads"].as<unsigned int>() : 0;
     }
     //--------------------------------------------------------------------------
 }
\ No newline at end of file
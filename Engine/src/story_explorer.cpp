@@ -0,0 +1,219 @@
+#include "story_explorer.h"
+#include "game_document_analyzer.h"
+#include "log.h"
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <unordered_set>
+#include <algorithm>
+
+namespace Storyteller
+{
+    StoryExplorer::StoryExplorer(const Ptr<GameDocument> document)
+        : _document(document)
+        , _storyGraph(StoryGraph::Compile(*document))
+    {}
+    //--------------------------------------------------------------------------
+
+    bool StoryExplorer::Explore(const Options& options, Result& result) const
+    {
+        if (!_storyGraph)
+        {
+            STRTLR_CORE_LOG_ERROR("StoryExplorer: game document is incorrect, nothing to explore");
+            return false;
+        }
+
+        STRTLR_CORE_LOG_INFO("StoryExplorer: exploring '{}', {} playthroughs", _document->GetGameName(), options.playthroughs);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        result = Result();
+        Simulate(options, result);
+        FindUnreachableQuests(result);
+        FindNonTerminatingQuests(result);
+
+        for (StoryGraph::Index i = 0; i < result.questVisits.size(); i++)
+        {
+            if (!result.questVisits[i])
+            {
+                result.unvisitedQuests.push_back(_storyGraph->GetQuestUuid(i));
+            }
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        STRTLR_CORE_LOG_INFO("StoryExplorer: {} of {} playthroughs completed in {:.3f}s, {} unreachable, {} non-terminating, {} unvisited quests",
+            result.completed, result.playthroughs, result.seconds, result.unreachableQuests.size(), result.nonTerminatingQuests.size(), result.unvisitedQuests.size());
+
+        return true;
+    }
+    //--------------------------------------------------------------------------
+
+    Ptr<StoryGraph> StoryExplorer::GetStoryGraph() const
+    {
+        return _storyGraph;
+    }
+    //--------------------------------------------------------------------------
+
+    void StoryExplorer::Simulate(const Options& options, Result& result) const
+    {
+        static constexpr uint64_t ChunkSize = 4096;
+
+        const auto threadsCount = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+        const auto questsCount = _storyGraph->GetQuestsCount();
+        const auto& graph = *_storyGraph;
+
+        std::atomic<uint64_t> nextPlaythrough(0);
+        std::mutex resultMutex;
+        uint64_t completedSteps = 0;
+
+        result.playthroughs = options.playthroughs;
+        result.questVisits.assign(questsCount, 0);
+
+        // workers grab chunks of playthroughs until none are left, so a slow worker never holds the others back,
+        // and count into their own storage which is merged once at the end
+        const auto worker = [&]() {
+            std::vector<uint64_t> questVisits(questsCount, 0);
+            uint64_t completed = 0;
+            uint64_t stepsLimitReached = 0;
+            uint64_t stuck = 0;
+            uint64_t steps = 0;
+
+            // splitmix64 reseeded per playthrough, results do not depend on the threads count
+            uint64_t randomState = 0;
+            const auto random = [&randomState]() {
+                auto z = (randomState += 0x9E3779B97F4A7C15ull);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            };
+
+            while (true)
+            {
+                const auto first = nextPlaythrough.fetch_add(ChunkSize, std::memory_order_relaxed);
+                if (first >= options.playthroughs)
+                {
+                    break;
+                }
+
+                const auto last = std::min(first + ChunkSize, options.playthroughs);
+                for (auto playthrough = first; playthrough < last; playthrough++)
+                {
+                    randomState = options.seed ^ (playthrough * 0xD1B54A32D192ED03ull);
+
+                    auto currentQuest = graph.GetEntryQuest();
+                    questVisits[currentQuest]++;
+
+                    unsigned int step = 0;
+                    for (; step < options.maxSteps; step++)
+                    {
+                        const auto& quest = graph.GetQuest(currentQuest);
+                        if (quest.actionsCount == 0)
+                        {
+                            stuck++;
+                            break;
+                        }
+
+                        const auto choice = StoryGraph::Index(random() % quest.actionsCount);
+                        currentQuest = graph.GetAction(graph.GetQuestAction(quest, choice)).target;
+                        questVisits[currentQuest]++;
+
+                        if (graph.GetQuest(currentQuest).final)
+                        {
+                            completed++;
+                            steps += step + 1;
+                            break;
+                        }
+                    }
+
+                    if (step == options.maxSteps)
+                    {
+                        stepsLimitReached++;
+                    }
+                }
+            }
+
+            std::lock_guard lock(resultMutex);
+            for (size_t i = 0; i < questsCount; i++)
+            {
+                result.questVisits[i] += questVisits[i];
+            }
+
+            result.completed += completed;
+            result.stepsLimitReached += stepsLimitReached;
+            result.stuck += stuck;
+            completedSteps += steps;
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadsCount);
+        for (unsigned int i = 0; i < threadsCount; i++)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        result.averagePathLength = result.completed ? double(completedSteps) / result.completed : 0.0;
+    }
+    //--------------------------------------------------------------------------
+
+    void StoryExplorer::FindUnreachableQuests(Result& result) const
+    {
+        std::unordered_set<UUID> reachable;
+        reachable.reserve(_storyGraph->GetQuestsCount());
+        for (StoryGraph::Index i = 0; i < _storyGraph->GetQuestsCount(); i++)
+        {
+            reachable.insert(_storyGraph->GetQuestUuid(i));
+        }
+
+        for (const auto& questObject : _document->GetObjects<QuestObject>())
+        {
+            if (!reachable.contains(questObject->GetUuid()))
+            {
+                result.unreachableQuests.push_back(questObject->GetUuid());
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+
+    void StoryExplorer::FindNonTerminatingQuests(Result& result) const
+    {
+        const auto& graph = *_storyGraph;
+        const auto questsCount = StoryGraph::Index(graph.GetQuestsCount());
+
+        std::vector<QuestGraphWalker::Edge> edges;
+        edges.reserve(graph.GetActionsCount());
+        std::vector<StoryGraph::Index> finalQuests;
+        for (StoryGraph::Index i = 0; i < questsCount; i++)
+        {
+            const auto& quest = graph.GetQuest(i);
+            if (quest.final)
+            {
+                finalQuests.push_back(i);
+            }
+
+            for (StoryGraph::Index j = 0; j < quest.actionsCount; j++)
+            {
+                edges.emplace_back(i, graph.GetAction(graph.GetQuestAction(quest, j)).target);
+            }
+        }
+
+        // the same backward walk from final quests as the document analyzer's
+        const auto terminating = QuestGraphWalker(questsCount, edges).FindTerminating(finalQuests);
+
+        for (StoryGraph::Index i = 0; i < questsCount; i++)
+        {
+            if (!terminating[i])
+            {
+                result.nonTerminatingQuests.push_back(graph.GetQuestUuid(i));
+            }
+        }
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
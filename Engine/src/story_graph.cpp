@@ -0,0 +1,211 @@
+#include "story_graph.h"
+#include "log.h"
+
+#include <unordered_map>
+
+namespace Storyteller
+{
+    Ptr<StoryGraph> StoryGraph::Compile(const GameDocument& document, CompileError* error)
+    {
+        STRTLR_CORE_LOG_INFO("StoryGraph: compiling '{}'", document.GetGameName());
+
+        Ptr<StoryGraph> graph(new StoryGraph());
+        graph->_domainName = document.GetDomainName();
+
+        std::unordered_map<std::string, Index> textIndices;
+        std::unordered_map<UUID, Index> questIndices;
+        std::unordered_map<UUID, Index> actionIndices;
+        std::vector<const QuestObject*> questObjects;
+
+        const auto addText = [&](const std::string& text) {
+            const auto [it, inserted] = textIndices.try_emplace(text, Index(graph->_texts.size()));
+            if (inserted)
+            {
+                graph->_texts.push_back(text);
+            }
+
+            return it->second;
+        };
+
+        const auto resolve = [&](const UUID& uuid, ObjectType requiredType) -> const BasicObject* {
+            const auto object = document.GetObject(uuid);
+            if (!object || object->GetObjectType() != requiredType)
+            {
+                STRTLR_CORE_LOG_ERROR("StoryGraph: object ({}) is {}, required: '{}'", uuid, object ? "not of correct type" : "null", ObjectTypeToString(requiredType));
+
+                if (error)
+                {
+                    error->uuid = uuid;
+                    error->requiredType = requiredType;
+                    error->objectMissing = !object;
+                }
+
+                return nullptr;
+            }
+
+            return object.get();
+        };
+
+        const auto addQuest = [&](const UUID& uuid) {
+            const auto it = questIndices.find(uuid);
+            if (it != questIndices.cend())
+            {
+                return it->second;
+            }
+
+            const auto questObject = static_cast<const QuestObject*>(resolve(uuid, ObjectType::QuestObjectType));
+            if (!questObject)
+            {
+                return InvalidIndex;
+            }
+
+            const auto index = Index(graph->_quests.size());
+            questIndices.emplace(uuid, index);
+            questObjects.push_back(questObject);
+            graph->_quests.push_back({ addText(questObject->GetText()), 0, 0, questObject->IsFinal() });
+            graph->_questUuids.push_back(uuid);
+
+            return index;
+        };
+
+        const auto addAction = [&](const UUID& uuid) {
+            const auto it = actionIndices.find(uuid);
+            if (it != actionIndices.cend())
+            {
+                return it->second;
+            }
+
+            const auto actionObject = static_cast<const ActionObject*>(resolve(uuid, ObjectType::ActionObjectType));
+            if (!actionObject)
+            {
+                return InvalidIndex;
+            }
+
+            const auto target = addQuest(actionObject->GetTargetUuid());
+            if (target == InvalidIndex)
+            {
+                return InvalidIndex;
+            }
+
+            const auto index = Index(graph->_actions.size());
+            actionIndices.emplace(uuid, index);
+            graph->_actions.push_back({ addText(actionObject->GetText()), target });
+            graph->_actionUuids.push_back(uuid);
+
+            return index;
+        };
+
+        graph->_gameNameText = addText(document.GetGameName());
+
+        const auto entryPoint = document.GetEntryPoint();
+        graph->_entryQuest = addQuest(entryPoint ? entryPoint->GetUuid() : UUID::InvalidUuid);
+        if (graph->_entryQuest == InvalidIndex)
+        {
+            return nullptr;
+        }
+
+        // quests are appended while their predecessors are walked, so this is a breadth-first traversal
+        for (Index questIndex = 0; questIndex < graph->_quests.size(); questIndex++)
+        {
+            const auto questObject = questObjects[questIndex];
+
+            // reaching a final quest ends the game, its actions are never offered
+            if (questObject->IsFinal() && questIndex != graph->_entryQuest)
+            {
+                continue;
+            }
+
+            const auto firstAction = Index(graph->_questActions.size());
+            for (const auto& actionUuid : questObject->GetActions())
+            {
+                const auto actionIndex = addAction(actionUuid);
+                if (actionIndex == InvalidIndex)
+                {
+                    return nullptr;
+                }
+
+                graph->_questActions.push_back(actionIndex);
+            }
+
+            graph->_quests[questIndex].firstAction = firstAction;
+            graph->_quests[questIndex].actionsCount = Index(graph->_questActions.size()) - firstAction;
+        }
+
+        STRTLR_CORE_LOG_INFO("StoryGraph: compiled {} quests, {} actions, {} texts", graph->_quests.size(), graph->_actions.size(), graph->_texts.size());
+
+        return graph;
+    }
+    //--------------------------------------------------------------------------
+
+    const std::string& StoryGraph::GetDomainName() const
+    {
+        return _domainName;
+    }
+    //--------------------------------------------------------------------------
+
+    StoryGraph::Index StoryGraph::GetGameNameText() const
+    {
+        return _gameNameText;
+    }
+    //--------------------------------------------------------------------------
+
+    StoryGraph::Index StoryGraph::GetEntryQuest() const
+    {
+        return _entryQuest;
+    }
+    //--------------------------------------------------------------------------
+
+    const StoryGraph::Quest& StoryGraph::GetQuest(Index index) const
+    {
+        return _quests[index];
+    }
+    //--------------------------------------------------------------------------
+
+    const StoryGraph::Action& StoryGraph::GetAction(Index index) const
+    {
+        return _actions[index];
+    }
+    //--------------------------------------------------------------------------
+
+    StoryGraph::Index StoryGraph::GetQuestAction(const Quest& quest, Index number) const
+    {
+        return _questActions[quest.firstAction + number];
+    }
+    //--------------------------------------------------------------------------
+
+    UUID StoryGraph::GetQuestUuid(Index index) const
+    {
+        return _questUuids[index];
+    }
+    //--------------------------------------------------------------------------
+
+    UUID StoryGraph::GetActionUuid(Index index) const
+    {
+        return _actionUuids[index];
+    }
+    //--------------------------------------------------------------------------
+
+    size_t StoryGraph::GetQuestsCount() const
+    {
+        return _quests.size();
+    }
+    //--------------------------------------------------------------------------
+
+    size_t StoryGraph::GetActionsCount() const
+    {
+        return _actions.size();
+    }
+    //--------------------------------------------------------------------------
+
+    const std::vector<std::string>& StoryGraph::GetTexts() const
+    {
+        return _texts;
+    }
+    //--------------------------------------------------------------------------
+
+    StoryGraph::StoryGraph()
+        : _gameNameText(InvalidIndex)
+        , _entryQuest(InvalidIndex)
+    {}
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -7,9 +7,9 @@ namespace Storyteller
     {}
     //--------------------------------------------------------------------------
 
-    bool WindowApplication::Initialize(const std::string& configPath)
+    bool WindowApplication::Initialize(const ProgramOptions& programOptions)
     {
-        if (!Application::Initialize(configPath))
+        if (!Application::Initialize(programOptions))
         {
             return false;
         }
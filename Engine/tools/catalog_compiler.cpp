@@ -0,0 +1,42 @@
+#include "Storyteller/i18n_catalog.h"
+#include "Storyteller/log.h"
+
+#include <iostream>
+
+// Compiles .po files of a domain into a translation catalog
+// usage: StorytellerCatalogCompiler <output.stc> <locale>=<file.po>...
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    LogConfig logConfig;
+    logConfig.outputConsole = true;
+    logConfig.outputFile = false;
+    logConfig.outputStringBuffer = false;
+    Log::Initialize(logConfig);
+
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <output.stc> <locale>=<file.po>..." << std::endl;
+        return 1;
+    }
+
+    I18N::CatalogBuilder builder;
+    for (auto i = 2; i < argc; i++)
+    {
+        const auto argument = std::string(argv[i]);
+        const auto separator = argument.find('=');
+        if (separator == std::string::npos || separator == 0)
+        {
+            std::cerr << "expected <locale>=<file.po>, got '" << argument << "'" << std::endl;
+            return 1;
+        }
+
+        if (!builder.AddPoFile(argument.substr(0, separator), std::filesystem::path(argument.substr(separator + 1))))
+        {
+            return 1;
+        }
+    }
+
+    return builder.Write(std::filesystem::path(argv[1])) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "Storyteller/game_document.h"
+#include "Storyteller/game_document_serializer.h"
+#include "Storyteller/log.h"
+
+#include <iostream>
+
+// Converts game documents between the JSON and binary formats, chosen by the file extensions
+// usage: StorytellerDocumentConverter <input> <output>
+int main(int argc, char** argv)
+{
+    using namespace Storyteller;
+
+    LogConfig logConfig;
+    logConfig.outputConsole = true;
+    logConfig.outputFile = false;
+    logConfig.outputStringBuffer = false;
+    Log::Initialize(logConfig);
+
+    if (argc != 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <input> <output>" << std::endl;
+        return 1;
+    }
+
+    const auto document = CreatePtr<GameDocument>();
+    GameDocumentSerializer serializer(document);
+    if (!serializer.Load(std::filesystem::path(argv[1])))
+    {
+        return 1;
+    }
+
+    return serializer.Save(std::filesystem::path(argv[2])) ? 0 : 1;
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Storyteller/function_utils.h"
 #include "Storyteller/console_utils.h"
 #include "Storyteller/platform.h"
+#include "Storyteller/strtlr_assert.h"
 
 #include <iostream>
 
@@ -11,6 +12,13 @@ namespace Storyteller
     ConsoleManager::ConsoleManager(const Ptr<I18N::Manager> i18nManager, char separator)
         : _i18nManager(i18nManager)
         , _separator(separator)
+        , _lookupDict(nullptr)
+        , _madeWithMessage(I18N::InvalidMessageId)
+        , _inputHintMessage(I18N::InvalidMessageId)
+        , _errorHintMessage(I18N::InvalidMessageId)
+        , _criticalHintMessage(I18N::InvalidMessageId)
+        , _endHintMessage(I18N::InvalidMessageId)
+        , _keyboardHitMessage(I18N::InvalidMessageId)
     {
         STRTLR_CLIENT_LOG_DEBUG("ConsoleManager: created, separator is '{}'", separator);
 
@@ -63,7 +71,7 @@ namespace Storyteller
 
     void ConsoleManager::PrintMadeByString() const
     {
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Made with Storyteller engine") << std::endl;
+        std::cout << _lookupDict->Get(_madeWithMessage) << std::endl;
     }
     //--------------------------------------------------------------------------
 
@@ -108,7 +116,7 @@ namespace Storyteller
 
     void ConsoleManager::PrintInputHint() const
     {
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Enter action: ");
+        std::cout << _lookupDict->Get(_inputHintMessage);
     }
     //--------------------------------------------------------------------------
 
@@ -116,7 +124,7 @@ namespace Storyteller
     {
         STRTLR_CLIENT_LOG_ERROR("ConsoleManager: error '{}'", details);
 
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Error: ") << details << std::endl;
+        std::cout << _lookupDict->Get(_errorHintMessage) << details << std::endl;
     }
     //--------------------------------------------------------------------------
 
@@ -124,7 +132,7 @@ namespace Storyteller
     {
         STRTLR_CLIENT_LOG_CRITICAL("ConsoleManager: critical error '{}'", details);
 
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Critical error: ") << details << std::endl;
+        std::cout << _lookupDict->Get(_criticalHintMessage) << details << std::endl;
 
         if (waitForKeyboardHit)
         {
@@ -135,13 +143,13 @@ namespace Storyteller
 
     void ConsoleManager::PrintEndHint() const
     {
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Game is over!") << std::endl;
+        std::cout << _lookupDict->Get(_endHintMessage) << std::endl;
     }
     //--------------------------------------------------------------------------
 
     void ConsoleManager::WaitForKeyboardHit() const
     {
-        std::cout << _i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Press any key...") << std::endl;
+        std::cout << _lookupDict->Get(_keyboardHitMessage) << std::endl;
         while (!Utils::KbHit()) {}
     }
     //--------------------------------------------------------------------------
@@ -160,14 +168,17 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
-    void ConsoleManager::FillDictionary() const
+    void ConsoleManager::FillDictionary()
     {
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Made with Storyteller engine");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Enter action: ");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Error: ");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Critical error: ");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Game is over!");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Press any key...");
+        _lookupDict = _i18nManager->GetLookupDictionary(STRTLR_TR_DOMAIN_RUNTIME);
+        STRTLR_ASSERT(_lookupDict);
+
+        _madeWithMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Made with Storyteller engine");
+        _inputHintMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Enter action: ");
+        _errorHintMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Error: ");
+        _criticalHintMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Critical error: ");
+        _endHintMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Game is over!");
+        _keyboardHitMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Press any key...");
     }
     //--------------------------------------------------------------------------
     //--------------------------------------------------------------------------
@@ -30,11 +30,18 @@ namespace Storyteller
         std::string ReadInput() const;
 
     private:
-        void FillDictionary() const;
+        void FillDictionary();
 
     private:
         const Ptr<I18N::Manager> _i18nManager;
         char _separator;
+        Ptr<I18N::LookupDictionary> _lookupDict;
+        I18N::MessageId _madeWithMessage;
+        I18N::MessageId _inputHintMessage;
+        I18N::MessageId _errorHintMessage;
+        I18N::MessageId _criticalHintMessage;
+        I18N::MessageId _endHintMessage;
+        I18N::MessageId _keyboardHitMessage;
     };
     //--------------------------------------------------------------------------
 }
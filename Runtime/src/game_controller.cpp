@@ -1,6 +1,7 @@
 #include "game_controller.h"
 #include "Storyteller/log.h"
 #include "Storyteller/function_utils.h"
+#include "Storyteller/strtlr_assert.h"
 
 namespace Storyteller
 {
@@ -8,9 +9,21 @@ namespace Storyteller
         : _consoleManager(CreatePtr<ConsoleManager>(i18nManager))
         , _gameDocument(gameDocument)
         , _i18nManager(i18nManager)
+        , _storyGraph(StoryGraph::Compile(*gameDocument, &_compileError))
+        , _translationsGeneration(0)
+        , _lookupDict(nullptr)
+        , _nullObjectMessage(I18N::InvalidMessageId)
+        , _wrongObjectTypeMessage(I18N::InvalidMessageId)
+        , _noActionMessage(I18N::InvalidMessageId)
+        , _wrongActionNumberMessage(I18N::InvalidMessageId)
     {
         STRTLR_CLIENT_LOG_INFO("GameController: create, game name '{}'", _gameDocument->GetGameName());
 
+        if (_storyGraph)
+        {
+            _translations.resize(_storyGraph->GetTexts().size());
+        }
+
         FillDictionary();
         _i18nManager->AddLocaleChangedCallback(STRTLR_BIND(GameController::FillDictionary));
     }
@@ -20,17 +33,20 @@ namespace Storyteller
     {
         STRTLR_CLIENT_LOG_INFO("GameController: launched...");
 
-        auto currentUuid = _gameDocument->GetEntryPoint()->GetUuid();
-
-        const auto noErrors = MainLoop(currentUuid);
-        if (noErrors)
+        if (!_storyGraph)
         {
-            End(currentUuid);
+            PrintCompileError();
+            return;
         }
+
+        auto currentQuest = _storyGraph->GetEntryQuest();
+
+        MainLoop(currentQuest);
+        End(currentQuest);
     }
     //--------------------------------------------------------------------------
 
-    bool GameController::MainLoop(UUID& currentUuid)
+    void GameController::MainLoop(StoryGraph::Index& currentQuest)
     {
         STRTLR_CLIENT_LOG_INFO("GameController: main loop started...");
 
@@ -38,70 +54,48 @@ namespace Storyteller
 
         while (!finalReached)
         {
-            if (!CheckObject(currentUuid, ObjectType::QuestObjectType))
-            {
-                return false;
-            }
-
-            NewFrame(currentUuid);
-
-            if (!ProcessActions(currentUuid, finalReached))
-            {
-                return false;
-            }
+            NewFrame(currentQuest);
+            ProcessActions(currentQuest, finalReached);
         }
-
-        return true;
     }
     //--------------------------------------------------------------------------
 
-    void GameController::End(UUID& currentUuid)
+    void GameController::End(StoryGraph::Index currentQuest)
     {
         STRTLR_CLIENT_LOG_INFO("GameController: ending...");
 
-        NewFrame(currentUuid);
+        NewFrame(currentQuest);
         
         _consoleManager->PrintEndHint();
         _consoleManager->WaitForKeyboardHit();
     }
     //--------------------------------------------------------------------------
 
-    bool GameController::CheckObject(const UUID& objectUuid, ObjectType type) const
+    void GameController::PrintCompileError() const
     {
-        const auto object = _gameDocument->GetObject(objectUuid);
-        if (!object)
+        const auto typeString = ObjectTypeToString(_compileError.requiredType);
+
+        if (_compileError.objectMissing)
         {
-            const auto typeString = ObjectTypeToString(type);
             STRTLR_CLIENT_LOG_CRITICAL("GameController: Game data is incorrect (object is null), required: '{}'", typeString);
-
-            _consoleManager->PrintCriticalHint(I18N::Translator::Format(_i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is null), required: {1}"), typeString));
-            return false;
+            _consoleManager->PrintCriticalHint(I18N::Translator::Format(_lookupDict->Get(_nullObjectMessage), typeString));
         }
-
-        if (object->GetObjectType() != type)
+        else
         {
-            const auto typeString = ObjectTypeToString(type);
-            STRTLR_CLIENT_LOG_CRITICAL("GameController: Game data is incorrect (object '{}' is not of correct type), required: '{}'", objectUuid, typeString);
-
-            _consoleManager->PrintCriticalHint(I18N::Translator::Format(_i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is not of correct type), required: {1}"), typeString));
-            return false;
+            STRTLR_CLIENT_LOG_CRITICAL("GameController: Game data is incorrect (object '{}' is not of correct type), required: '{}'", _compileError.uuid, typeString);
+            _consoleManager->PrintCriticalHint(I18N::Translator::Format(_lookupDict->Get(_wrongObjectTypeMessage), typeString));
         }
-
-        return true;
     }
     //--------------------------------------------------------------------------
 
-    bool GameController::ProcessActions(UUID& currentUuid, bool& finalReached)
+    void GameController::ProcessActions(StoryGraph::Index& currentQuest, bool& finalReached)
     {
-        const auto questObject = dynamic_cast<QuestObject*>(_gameDocument->GetObject(currentUuid).get());
-        const auto& questActions = questObject->GetActions();
-        if (!PrintActions(questActions))
-        {
-            return false;
-        }
+        const auto& quest = _storyGraph->GetQuest(currentQuest);
+        PrintActions(quest);
+        PrefetchTranslations(quest);
 
         int actionNumber = 0;
-        while (!actionNumber || (actionNumber > questActions.size()))
+        while (!actionNumber || (actionNumber > quest.actionsCount))
         {
             _consoleManager->PrintInputHint();
             const auto input = _consoleManager->ReadInput();
@@ -109,76 +103,96 @@ namespace Storyteller
             try
             {
                 actionNumber = std::stoi(input);
-                if (actionNumber >= 1 && actionNumber <= questActions.size())
+                if (actionNumber >= 1 && actionNumber <= quest.actionsCount)
                 {
-                    const auto& chosenActionUuid = questActions.at(actionNumber - 1);
-                    if (!CheckObject(chosenActionUuid, ObjectType::ActionObjectType))
-                    {
-                        return false;
-                    }
-
-                    const auto chosenActionObject = dynamic_cast<ActionObject*>(_gameDocument->GetObject(chosenActionUuid).get());
-                    currentUuid = chosenActionObject->GetTargetUuid();
-                    finalReached = (dynamic_cast<QuestObject*>(_gameDocument->GetObject(currentUuid).get()))->IsFinal();
+                    const auto& chosenAction = _storyGraph->GetAction(_storyGraph->GetQuestAction(quest, actionNumber - 1));
+                    currentQuest = chosenAction.target;
+                    finalReached = _storyGraph->GetQuest(currentQuest).final;
                 }
                 else
                 {
-                    STRTLR_CLIENT_LOG_ERROR("GameController: action index input error, input is '{}', number of actions is '{}'", actionNumber, questActions.size());
-                    _consoleManager->PrintErrorHint(_i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "No action found, try again"));
+                    STRTLR_CLIENT_LOG_ERROR("GameController: action index input error, input is '{}', number of actions is '{}'", actionNumber, quest.actionsCount);
+                    _consoleManager->PrintErrorHint(_lookupDict->Get(_noActionMessage));
                 }
             }
             catch (const std::exception&)
             {
                 STRTLR_CLIENT_LOG_CRITICAL("GameController: cannot recognize action number, input is '{}'", input);
-                _consoleManager->PrintErrorHint(_i18nManager->Translation(STRTLR_TR_DOMAIN_RUNTIME, "Cannot recognize action number, try again"));
+                _consoleManager->PrintErrorHint(_lookupDict->Get(_wrongActionNumberMessage));
             }
         }
-
-        return true;
     }
     //--------------------------------------------------------------------------
 
-    bool GameController::PrintActions(const std::vector<UUID>& questActions) const
+    void GameController::PrintActions(const StoryGraph::Quest& quest) const
     {
         std::vector<std::string> actionTexts;
-        actionTexts.reserve(questActions.size());
+        actionTexts.reserve(quest.actionsCount);
 
-        for (auto i = 0; i < questActions.size(); i++)
+        for (StoryGraph::Index i = 0; i < quest.actionsCount; i++)
         {
-            const auto object = _gameDocument->GetObject(questActions.at(i));
-            if (!CheckObject(questActions.at(i), ObjectType::ActionObjectType))
-            {
-                return false;
-            }
-
-            const auto actionObject = dynamic_cast<ActionObject*>(object.get());
-            actionTexts.emplace_back(_i18nManager->Translation(_gameDocument->GetDomainName(), actionObject->GetText()));
+            const auto& action = _storyGraph->GetAction(_storyGraph->GetQuestAction(quest, i));
+            actionTexts.emplace_back(GetTranslation(action.text));
         }
 
         _consoleManager->PrintActions(actionTexts);
+    }
+    //--------------------------------------------------------------------------
+
+    void GameController::NewFrame(StoryGraph::Index currentQuest) const
+    {
+        STRTLR_CLIENT_LOG_INFO("GameController: new frame, current uuid is '{}'", _storyGraph->GetQuestUuid(currentQuest));
+
+        _consoleManager->StartNewFrame(GetTranslation(_storyGraph->GetGameNameText()));
+        _consoleManager->PrintMessage(GetTranslation(_storyGraph->GetQuest(currentQuest).text));
+    }
+    //--------------------------------------------------------------------------
 
-        return true;
+    const std::string& GameController::GetTranslation(StoryGraph::Index text) const
+    {
+        auto& translation = _translations[text];
+        if (translation.generation != _translationsGeneration)
+        {
+            // the lookup dictionary keeps its entries, so the pointer stays valid
+            translation.text = &_i18nManager->TranslationLazy(_storyGraph->GetDomainName(), _storyGraph->GetTexts()[text]);
+            translation.generation = _translationsGeneration;
+        }
+
+        return *translation.text;
     }
     //--------------------------------------------------------------------------
 
-    void GameController::NewFrame(UUID& objectUuid) const
+    void GameController::PrefetchTranslations(const StoryGraph::Quest& quest) const
     {
-        STRTLR_CLIENT_LOG_INFO("GameController: new frame, current uuid is '{}'", objectUuid);
+        // texts of the quests the player can go to next are translated while the input is awaited
+        std::vector<std::string> texts;
+        for (StoryGraph::Index i = 0; i < quest.actionsCount; i++)
+        {
+            const auto& nextQuest = _storyGraph->GetQuest(_storyGraph->GetAction(_storyGraph->GetQuestAction(quest, i)).target);
+            texts.push_back(_storyGraph->GetTexts()[nextQuest.text]);
 
-        auto object = _gameDocument->GetObject(objectUuid);
-        const auto textObject = dynamic_cast<TextObject*>(object.get());
+            for (StoryGraph::Index j = 0; j < nextQuest.actionsCount; j++)
+            {
+                texts.push_back(_storyGraph->GetTexts()[_storyGraph->GetAction(_storyGraph->GetQuestAction(nextQuest, j)).text]);
+            }
+        }
 
-        _consoleManager->StartNewFrame(_i18nManager->Translation(_gameDocument->GetDomainName(), _gameDocument->GetGameName()));
-        _consoleManager->PrintMessage(_i18nManager->Translation(_gameDocument->GetDomainName(), textObject->GetText()));
+        _i18nManager->Prefetch(_storyGraph->GetDomainName(), std::move(texts));
     }
     //--------------------------------------------------------------------------
 
-    void GameController::FillDictionary() const
+    void GameController::FillDictionary()
     {
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is null), required: {1}");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is not of correct type), required: {1}");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "No action found, try again");
-        _i18nManager->Translate(STRTLR_TR_DOMAIN_RUNTIME, "Cannot recognize action number, try again");
+        _lookupDict = _i18nManager->GetLookupDictionary(STRTLR_TR_DOMAIN_RUNTIME);
+        STRTLR_ASSERT(_lookupDict);
+
+        _nullObjectMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is null), required: {1}");
+        _wrongObjectTypeMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Game data is incorrect (object is not of correct type), required: {1}");
+        _noActionMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "No action found, try again");
+        _wrongActionNumberMessage = _i18nManager->TranslateHandle(STRTLR_TR_DOMAIN_RUNTIME, "Cannot recognize action number, try again");
+
+        // story texts are translated again on their next access
+        ++_translationsGeneration;
     }
     //--------------------------------------------------------------------------
     //--------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 #include "console_manager.h"
 #include "Storyteller/pointers.h"
 #include "Storyteller/game_document.h"
+#include "Storyteller/story_graph.h"
 #include "Storyteller/i18n_manager.h"
 
 namespace Storyteller
@@ -15,21 +16,42 @@ namespace Storyteller
         void Launch();
 
     private:
-        bool MainLoop(UUID& currentUuid);
-        void End(UUID& currentUuid);
+        void MainLoop(StoryGraph::Index& currentQuest);
+        void End(StoryGraph::Index currentQuest);
 
-        bool CheckObject(const UUID& objectUuid, ObjectType type) const;
-        bool ProcessActions(UUID& currentUuid, bool& finalReached);
-        bool PrintActions(const std::vector<UUID>& questActions) const;
-        void NewFrame(UUID& currentQuestObject) const;
+        void PrintCompileError() const;
+        void ProcessActions(StoryGraph::Index& currentQuest, bool& finalReached);
+        void PrintActions(const StoryGraph::Quest& quest) const;
+        void NewFrame(StoryGraph::Index currentQuest) const;
+
+        const std::string& GetTranslation(StoryGraph::Index text) const;
+        void PrefetchTranslations(const StoryGraph::Quest& quest) const;
+
+    private:
+        struct Translation
+        {
+            const std::string* text = nullptr;
+            uint32_t generation = 0;
+        };
 
     private:
-        void FillDictionary() const;
+        void FillDictionary();
 
     private:
         const Ptr<ConsoleManager> _consoleManager;
         const Ptr<GameDocument> _gameDocument;
         const Ptr<I18N::Manager> _i18nManager;
+
+        StoryGraph::CompileError _compileError;
+        const Ptr<StoryGraph> _storyGraph;
+        // story texts are translated on the first access, the generation changes with the locale
+        mutable std::vector<Translation> _translations;
+        uint32_t _translationsGeneration;
+        Ptr<I18N::LookupDictionary> _lookupDict;
+        I18N::MessageId _nullObjectMessage;
+        I18N::MessageId _wrongObjectTypeMessage;
+        I18N::MessageId _noActionMessage;
+        I18N::MessageId _wrongActionNumberMessage;
     };
     //--------------------------------------------------------------------------
 }
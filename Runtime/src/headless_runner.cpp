@@ -0,0 +1,189 @@
+#include "headless_runner.h"
+#include "Storyteller/log.h"
+#include "Storyteller/filesystem.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <random>
+#include <chrono>
+
+namespace Storyteller
+{
+    HeadlessRunner::HeadlessRunner(const Ptr<StoryGraph> storyGraph, uint64_t seed, unsigned int maxSteps)
+        : _storyGraph(storyGraph)
+        , _seed(seed)
+        , _maxSteps(maxSteps)
+    {
+        STRTLR_CLIENT_LOG_INFO("HeadlessRunner: create, seed is '{}', steps limit is '{}'", seed, maxSteps);
+    }
+    //--------------------------------------------------------------------------
+
+    bool HeadlessRunner::LoadChoices(const std::filesystem::path& path)
+    {
+        std::ifstream inputStream(path);
+        if (!inputStream.is_open() || !inputStream.good())
+        {
+            STRTLR_CLIENT_LOG_ERROR("HeadlessRunner: cannot open choices file '{}'", Filesystem::ToU8String(path));
+            return false;
+        }
+
+        _choices.clear();
+
+        std::string line;
+        auto lineNumber = 0;
+        while (std::getline(inputStream, line))
+        {
+            lineNumber++;
+            if (line.empty() || line.front() == '#')
+            {
+                continue;
+            }
+
+            // action numbers are 1-based, as the player enters them
+            std::vector<StoryGraph::Index> choices;
+            std::istringstream lineStream(line);
+            long long actionNumber = 0;
+            while (lineStream >> actionNumber)
+            {
+                if (actionNumber < 1)
+                {
+                    STRTLR_CLIENT_LOG_ERROR("HeadlessRunner: invalid action number '{}' at line {}", actionNumber, lineNumber);
+                    return false;
+                }
+
+                choices.push_back(StoryGraph::Index(actionNumber - 1));
+            }
+
+            if (!lineStream.eof())
+            {
+                STRTLR_CLIENT_LOG_ERROR("HeadlessRunner: cannot recognize action number at line {}", lineNumber);
+                return false;
+            }
+
+            if (!choices.empty())
+            {
+                _choices.push_back(std::move(choices));
+            }
+        }
+
+        STRTLR_CLIENT_LOG_INFO("HeadlessRunner: loaded {} scripted playthroughs from '{}'", _choices.size(), Filesystem::ToU8String(path));
+
+        return !_choices.empty();
+    }
+    //--------------------------------------------------------------------------
+
+    HeadlessRunner::Report HeadlessRunner::Run(unsigned int playthroughsCount) const
+    {
+        STRTLR_CLIENT_LOG_INFO("HeadlessRunner: running {} playthroughs", playthroughsCount);
+
+        Report report;
+        const auto start = std::chrono::steady_clock::now();
+
+        // aborts are only counted here, logging each of them would be timed along with the playthroughs
+        for (unsigned int i = 0; i < playthroughsCount; i++)
+        {
+            switch (Playthrough(i, report.steps))
+            {
+            case Outcome::Completed:
+                report.completed++;
+                break;
+            case Outcome::Stuck:
+                report.stuck++;
+                break;
+            case Outcome::OutOfChoices:
+                report.outOfChoices++;
+                break;
+            case Outcome::InvalidChoice:
+                report.invalidChoices++;
+                break;
+            case Outcome::StepsExceeded:
+                report.stepsExceeded++;
+                break;
+            }
+
+            report.playthroughs++;
+        }
+
+        report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (report.completed != report.playthroughs)
+        {
+            STRTLR_CLIENT_LOG_WARN("HeadlessRunner: {} playthroughs aborted, {} stuck at a quest with no actions, {} ran out of scripted choices, {} chose a missing action, {} exceeded {} steps",
+                report.playthroughs - report.completed, report.stuck, report.outOfChoices, report.invalidChoices, report.stepsExceeded, _maxSteps);
+        }
+
+        return report;
+    }
+    //--------------------------------------------------------------------------
+
+    void HeadlessRunner::PrintReport(const Report& report) const
+    {
+        const auto playthroughsPerSecond = report.seconds > 0.0 ? report.playthroughs / report.seconds : 0.0;
+        const auto stepsPerSecond = report.seconds > 0.0 ? report.steps / report.seconds : 0.0;
+
+        STRTLR_CLIENT_LOG_INFO("HeadlessRunner: {} playthroughs, {} completed, {} steps in {:.3f}s, {:.1f} playthroughs/s, {:.1f} steps/s",
+            report.playthroughs, report.completed, report.steps, report.seconds, playthroughsPerSecond, stepsPerSecond);
+
+        std::cout << "Playthroughs: " << report.playthroughs << std::endl;
+        std::cout << "Completed: " << report.completed << std::endl;
+        std::cout << "Aborted: " << report.playthroughs - report.completed << std::endl;
+        std::cout << "  stuck at a quest with no actions: " << report.stuck << std::endl;
+        std::cout << "  out of scripted choices: " << report.outOfChoices << std::endl;
+        std::cout << "  invalid scripted choice: " << report.invalidChoices << std::endl;
+        std::cout << "  steps limit exceeded: " << report.stepsExceeded << std::endl;
+        std::cout << "Steps: " << report.steps << std::endl;
+        std::cout << "Time, s: " << report.seconds << std::endl;
+        std::cout << "Playthroughs per second: " << playthroughsPerSecond << std::endl;
+        std::cout << "Steps per second: " << stepsPerSecond << std::endl;
+    }
+    //--------------------------------------------------------------------------
+
+    HeadlessRunner::Outcome HeadlessRunner::Playthrough(unsigned int number, uint64_t& steps) const
+    {
+        const auto script = _choices.empty() ? nullptr : &_choices[number % _choices.size()];
+
+        // the engine output is fixed by the standard, unlike distributions, so runs are reproducible across platforms
+        std::mt19937_64 random(_seed + number);
+
+        auto currentQuest = _storyGraph->GetEntryQuest();
+        for (unsigned int step = 0; step < _maxSteps; step++)
+        {
+            const auto& quest = _storyGraph->GetQuest(currentQuest);
+            if (quest.actionsCount == 0)
+            {
+                return Outcome::Stuck;
+            }
+
+            StoryGraph::Index choice;
+            if (script)
+            {
+                if (step >= script->size())
+                {
+                    return Outcome::OutOfChoices;
+                }
+
+                choice = (*script)[step];
+                if (choice >= quest.actionsCount)
+                {
+                    return Outcome::InvalidChoice;
+                }
+            }
+            else
+            {
+                choice = StoryGraph::Index(random() % quest.actionsCount);
+            }
+
+            currentQuest = _storyGraph->GetAction(_storyGraph->GetQuestAction(quest, choice)).target;
+            steps++;
+
+            if (_storyGraph->GetQuest(currentQuest).final)
+            {
+                return Outcome::Completed;
+            }
+        }
+
+        return Outcome::StepsExceeded;
+    }
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
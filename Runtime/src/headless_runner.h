@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Storyteller/pointers.h"
+#include "Storyteller/story_graph.h"
+
+#include <filesystem>
+#include <vector>
+#include <cstdint>
+
+namespace Storyteller
+{
+    // Plays a story graph without console, choices come either from a script
+    // or from a seeded random policy so that runs are reproducible
+    class HeadlessRunner
+    {
+    public:
+        struct Report
+        {
+            unsigned int playthroughs = 0;
+            unsigned int completed = 0;
+            // reasons of the aborted playthroughs
+            unsigned int stuck = 0;
+            unsigned int outOfChoices = 0;
+            unsigned int invalidChoices = 0;
+            unsigned int stepsExceeded = 0;
+            uint64_t steps = 0;
+            double seconds = 0.0;
+        };
+
+    public:
+        static constexpr unsigned int DefaultPlaythroughsCount = 1;
+
+    public:
+        HeadlessRunner(const Ptr<StoryGraph> storyGraph, uint64_t seed, unsigned int maxSteps);
+
+        bool LoadChoices(const std::filesystem::path& path);
+
+        Report Run(unsigned int playthroughsCount) const;
+        void PrintReport(const Report& report) const;
+
+    private:
+        enum class Outcome
+        {
+            Completed,
+            Stuck,
+            OutOfChoices,
+            InvalidChoice,
+            StepsExceeded
+        };
+
+        Outcome Playthrough(unsigned int number, uint64_t& steps) const;
+
+    private:
+        const Ptr<StoryGraph> _storyGraph;
+        const uint64_t _seed;
+        const unsigned int _maxSteps;
+        std::vector<std::vector<StoryGraph::Index>> _choices;
+    };
+    //--------------------------------------------------------------------------
+}
\ No newline at end of file
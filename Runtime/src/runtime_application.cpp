@@ -3,6 +3,8 @@
 #include "Storyteller/storyteller.h"
 #include "Storyteller/log.h"
 
+#include <iostream>
+
 namespace Storyteller
 {
     Application* CreateApplication()
@@ -14,6 +16,9 @@ namespace Storyteller
         : Application()
         , _manager(nullptr)
         , _gameController(nullptr)
+        , _headlessRunner(nullptr)
+        , _headlessPlaythroughs(0)
+        , _storyExplorer(nullptr)
         , _gameDocumentPath("")
     {}
     //--------------------------------------------------------------------------
@@ -24,9 +29,9 @@ namespace Storyteller
     }
     //--------------------------------------------------------------------------
 
-    bool RuntimeApplication::Initialize(const std::string& configPath)
+    bool RuntimeApplication::Initialize(const ProgramOptions& programOptions)
     {
-        if (!Application::Initialize(configPath))
+        if (!Application::Initialize(programOptions))
         {
             return false;
         }
@@ -49,6 +54,41 @@ namespace Storyteller
             return false;
         }
 
+        if (programOptions.IsExplore())
+        {
+            _storyExplorer.reset(new StoryExplorer(_manager->GetDocument()));
+            if (programOptions.GetPlaythroughsCount())
+            {
+                _explorerOptions.playthroughs = programOptions.GetPlaythroughsCount();
+            }
+
+            _explorerOptions.seed = programOptions.GetSeed();
+            _explorerOptions.maxSteps = programOptions.GetMaxSteps();
+            _explorerOptions.threads = programOptions.GetThreadsCount();
+
+            return true;
+        }
+
+        if (programOptions.IsHeadless())
+        {
+            const auto storyGraph = StoryGraph::Compile(*_manager->GetDocument());
+            if (!storyGraph)
+            {
+                STRTLR_CLIENT_LOG_ERROR("RuntimeApplication: game document '{}' is incorrect", _gameDocumentPath);
+                return false;
+            }
+
+            _headlessRunner.reset(new HeadlessRunner(storyGraph, programOptions.GetSeed(), programOptions.GetMaxSteps()));
+            _headlessPlaythroughs = programOptions.GetPlaythroughsCount() ? programOptions.GetPlaythroughsCount() : HeadlessRunner::DefaultPlaythroughsCount;
+
+            if (!programOptions.GetChoicesPath().empty() && !_headlessRunner->LoadChoices(programOptions.GetChoicesPath()))
+            {
+                return false;
+            }
+
+            return true;
+        }
+
         _gameController.reset(new GameController(_manager->GetDocument(), _i18nManager));
 
         return true;
@@ -57,10 +97,59 @@ namespace Storyteller
 
     void RuntimeApplication::Run()
     {
+        if (_storyExplorer)
+        {
+            Explore();
+            return;
+        }
+
+        if (_headlessRunner)
+        {
+            _headlessRunner->PrintReport(_headlessRunner->Run(_headlessPlaythroughs));
+            return;
+        }
+
         _gameController->Launch();
     }
     //--------------------------------------------------------------------------
 
+    void RuntimeApplication::Explore() const
+    {
+        StoryExplorer::Result result;
+        if (!_storyExplorer->Explore(_explorerOptions, result))
+        {
+            std::cout << "Game document is incorrect, see the log for details" << std::endl;
+            return;
+        }
+
+        const auto printQuests = [](const char* title, const std::vector<UUID>& quests) {
+            std::cout << title << ": " << quests.size() << std::endl;
+            for (const auto& uuid : quests)
+            {
+                std::cout << "    " << uuid << std::endl;
+            }
+        };
+
+        std::cout << "Playthroughs: " << result.playthroughs << std::endl;
+        std::cout << "Completed: " << result.completed << std::endl;
+        std::cout << "Steps limit reached: " << result.stepsLimitReached << std::endl;
+        std::cout << "Stuck: " << result.stuck << std::endl;
+        std::cout << "Average path length: " << result.averagePathLength << std::endl;
+        std::cout << "Time, s: " << result.seconds << std::endl;
+
+        const auto storyGraph = _storyExplorer->GetStoryGraph();
+        std::cout << "Quest visits:" << std::endl;
+        for (StoryGraph::Index i = 0; i < result.questVisits.size(); i++)
+        {
+            std::cout << "    " << storyGraph->GetQuestUuid(i) << ": " << result.questVisits[i] << std::endl;
+        }
+
+        printQuests("Unreachable quests", result.unreachableQuests);
+        printQuests("Quests with no way to a final quest", result.nonTerminatingQuests);
+        printQuests("Reachable quests never visited", result.unvisitedQuests);
+    }
+    //--------------------------------------------------------------------------
+
     void RuntimeApplication::LoadSettings()
     {
         _settings->StartLoad();
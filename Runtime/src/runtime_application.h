@@ -1,7 +1,9 @@
 #pragma once
 
 #include "game_controller.h"
+#include "headless_runner.h"
 #include "Storyteller/game_document_manager.h"
+#include "Storyteller/story_explorer.h"
 #include "Storyteller/pointers.h"
 #include "Storyteller/application.h"
 
@@ -14,15 +16,20 @@ namespace Storyteller
 
         std::string GetApplicationName() const override;
 
-        bool Initialize(const std::string& configPath) override;
+        bool Initialize(const ProgramOptions& programOptions) override;
         void Run() override;
 
     private:
         void LoadSettings();
+        void Explore() const;
 
     private:
         Ptr<GameDocumentManager> _manager;
         Ptr<GameController> _gameController;
+        Ptr<HeadlessRunner> _headlessRunner;
+        unsigned int _headlessPlaythroughs;
+        Ptr<StoryExplorer> _storyExplorer;
+        StoryExplorer::Options _explorerOptions;
         std::string _gameDocumentPath;
     };
     //--------------------------------------------------------------------------
@@ -79,6 +79,7 @@ function(CreateTranslationHelperTargets STRTLR_TARGET_NAME STRTLR_PO_PREFIX STRT
 				--keyword="TranslateDefer:2,3,4t"
 				--keyword="TranslateCtxDefer:2,3c,3t"
 				--keyword="TranslateCtxDefer:2,3,5t,5t"
+				--keyword="TranslateHandle:2,2t"
 				${STRTLR_SOURCE_FILES}
 			WORKING_DIRECTORY ${STRTLR_TARGET_PREFIX_DIR}
 			COMMAND ${CMAKE_COMMAND} -E echo  "${STRTLR_PO_PREFIX}.pot file generated: ${STRTLR_TARGET_PREFIX_DIR}/locale/${STRTLR_PO_PREFIX}.pot"
@@ -160,4 +161,37 @@ function(CreateTranslationHelperTargets STRTLR_TARGET_NAME STRTLR_PO_PREFIX STRT
 				endif()
 		endforeach()
 	endif()
+endfunction()
+
+
+# Compiles all .po files of the prefix into a single catalog read by the engine without the locale generator
+# params:
+# [STRTLR_TARGET_NAME] - name of the target (e.g. StorytellerEditor)
+# [STRTLR_PO_PREFIX] - name of the .po files and the catalog (e.g. Storyteller)
+# [STRTLR_TARGET_PREFIX_DIR] - prefix directory (e.g. ${CMAKE_CURRENT_SOURCE_DIR}
+# [STRTLR_FOLDER] - folder to place created targets (e.g. Storyteller/Editor)
+function(CreateTranslationCatalogTarget STRTLR_TARGET_NAME STRTLR_PO_PREFIX STRTLR_TARGET_PREFIX_DIR STRTLR_FOLDER)
+	file(GLOB PO_FILES ${STRTLR_TARGET_PREFIX_DIR}/locale/*/LC_MESSAGES/${STRTLR_PO_PREFIX}.po)
+	message(STATUS " ${STRTLR_TARGET_NAME} catalog PO_FILES: ${PO_FILES}")
+	
+	set(CATALOG_FILE ${STRTLR_TARGET_PREFIX_DIR}/locale/${STRTLR_PO_PREFIX}.stc)
+	set(CATALOG_ARGS)
+	foreach(PO_FILE IN ITEMS ${PO_FILES})
+		cmake_path(GET PO_FILE PARENT_PATH PO_LANG_DIR)
+		cmake_path(GET PO_LANG_DIR PARENT_PATH PO_LANG_DIR)
+		cmake_path(GET PO_LANG_DIR FILENAME LANG_NAME)
+		list(APPEND CATALOG_ARGS "${LANG_NAME}=${PO_FILE}")
+	endforeach()
+	
+	add_custom_command(OUTPUT ${CATALOG_FILE}
+		COMMAND StorytellerCatalogCompiler ${CATALOG_FILE} ${CATALOG_ARGS}
+		DEPENDS StorytellerCatalogCompiler ${PO_FILES}
+		COMMAND ${CMAKE_COMMAND} -E echo  "${STRTLR_PO_PREFIX}.stc catalog generated: ${CATALOG_FILE}"
+	)
+	
+	add_custom_target(${STRTLR_TARGET_NAME}_catalog_compile
+		COMMAND ${CMAKE_COMMAND} -E echo  "${STRTLR_PO_PREFIX}.stc compilation: Done!"
+		DEPENDS ${CATALOG_FILE}
+	)
+	set_property(TARGET ${STRTLR_TARGET_NAME}_catalog_compile APPEND PROPERTY FOLDER ${STRTLR_FOLDER})
 endfunction()
\ No newline at end of file